@@ -6,8 +6,9 @@
 /*!
  \file acos.inl
 
- Provides CORDIC for acos function.
- \ref see see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures".
+ Provides the double-rotation CORDIC for acos function, see
+ libq::details::asin_double_rotation.
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures".
 */
 
 #ifndef INC_STD_ACOS_INL_
@@ -35,6 +36,85 @@ class acos_of<libq::fixed_point<T, n, f, e, op, up> >
 }  // namespace libq
 
 
+namespace libq {
+/*!
+ \brief Computes the arccosine by CORDIC with the reduced number of
+ iterations.
+ \tparam bits number of accurate fractional bits the caller needs
+ \note The absolute error is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+typename libq::details::acos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    acos(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using result_type = typename libq::details::acos_of<Q>::promoted_type;
+    using precision = libq::details::precision_traits<bits, f>;
+    using work_type = typename libq::details::acos_of<
+        libq::fixed_point<T, n, precision::bits_for_fractional, e, op, up> >::promoted_type;  // NOLINT
+
+    assert(("[std::acos] argument is not from [-1.0, 1.0]",
+            std::fabs(_val) <= Q(1.0)));
+    if (std::fabs(_val) > Q(1.0)) {
+        throw std::logic_error("[std::acos] argument is not from [-1.0, 1.0]");
+    }
+    if (_val == Q(1.0)) {
+        return result_type::wrap(0);
+    } else if (_val == Q(-1.0)) {
+        return result_type::CONST_PI;
+    } else if (_val == Q::wrap(0)) {
+        return result_type::CONST_PI_2;
+    }
+
+    // acos(x) = pi/2 - asin(x), the arcsine is from [-pi/2, pi/2]
+    work_type const z =
+        libq::details::asin_double_rotation<precision::iterations>(
+            work_type(_val));
+
+    return result_type(work_type::CONST_PI_2 - z);
+}
+}  // namespace libq
+
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the arccosine by the engine.
+*/
+template<class Engine>
+class acos_impl;
+
+
+template<>
+class acos_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::acos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        return libq::acos<f>(_val);
+    }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the arccosine by the chosen engine.
+ \tparam Engine libq::engine::cordic or libq::engine::cordic_radix4
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::acos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    acos(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::acos_impl<Engine>::apply(_val);
+}
+}  // namespace libq
+
+
 namespace std {
 /*!
  <I>Example 1</I>: "how-to" to improve the performance of the array
@@ -92,59 +172,10 @@ template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
 typename libq::details::acos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
     acos(libq::fixed_point<T, n, f, e, op, up> _val) {
     using Q = libq::fixed_point<T, n, f, e, op, up>;
-    using result_type = typename libq::details::acos_of<Q>::promoted_type;
-    using lut_type = libq::cordic::lut<f, Q>;
-
-    assert(("[std::acos] argument is not from [-1.0, 1.0]",
-            std::fabs(_val) <= Q(1.0)));
-    if (std::fabs(_val) > Q(1.0)) {
-        throw std::logic_error("[std::acos] argument is not from [-1.0, 1.0]");
-    }
-    if (_val == Q(1.0)) {
-        return result_type::wrap(0);
-    } else if (_val == Q(-1.0)) {
-        return result_type::CONST_PI;
-    } else if (_val == Q::wrap(0)) {
-        return result_type::CONST_PI_2;
-    }
-
-    bool const is_negative = std::signbit(_val);
-    _val = std::fabs(_val);
-
-
-    static lut_type const angles = lut_type::circular();
-    static lut_type const scales = lut_type::circular_scales();
-
-    // rotation mode: see page 6
-    // shift sequence is just 0, 1, ... (circular coordinate system)
-    result_type x(1.0), y(0.0), z(0.0);
-
-#ifdef LOOP_UNROLLING
-    auto const iteration_body = [&](std::size_t i) {  // NOLINT
-#else
-#pragma unroll
-    for (std::size_t i = 0u; i != f; ++i) {
-#endif
-        int sign(0);
-        if (_val <= x) {
-            sign = (y < 0.0) ? -1 : +1;
-        } else {
-            sign = (y < 0.0) ? +1 : -1;
-        }
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::acos>::type;
 
-        typename result_type::storage_type const storage(x.value());
-        x = x - result_type::wrap(sign * (y.value() >> i));
-        y = y + result_type::wrap(sign * (storage >> i));
-        z = (sign > 0)? z + angles[i] : z - angles[i];
-        _val = _val * scales[i];  // multiply by square of K(n)
-    };  // NOLINT
-#ifdef LOOP_UNROLLING
-    libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f-1>());
-#endif
-
-    return (is_negative) ?
-               result_type(result_type::CONST_PI - std::fabs(z)) :
-               std::fabs(result_type(z));
+    return libq::acos<engine_type>(_val);
 }
 }  // namespace std
 
@@ -0,0 +1,158 @@
+// angle.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file angle.inl
+
+ Provides CORDIC for sin, cos and atan2 functions of the binary angle
+ libq::angle
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_CORDIC_ANGLE_INL_
+#define INC_LIBQ_CORDIC_ANGLE_INL_
+
+#include <utility>
+
+namespace libq {
+namespace details {
+template<std::size_t bits>
+class sin_of<libq::angle<bits> > {
+ public:
+    using promoted_type = libq::Q<bits - 1u, bits - 2u>;
+};
+
+template<std::size_t bits>
+class cos_of<libq::angle<bits> >
+    : public libq::details::sin_of<libq::angle<bits> > {
+};
+
+
+/*!
+ \brief Computes both sine and cosine of the binary angle.
+ \details The quadrant is the two most significant bits of the angle rounded
+ to the nearest quarter of the turn, the rest bits give the remainder
+ \f$r \in [-\frac{\pi}{4}, \frac{\pi}{4})\f$: it is converted to radians by
+ the single integer multiplication. So no division and no reduction by
+ \f$\frac{\pi}{2}\f$ are needed.
+*/
+template<std::size_t bits>
+std::pair<typename libq::details::sin_of<libq::angle<bits> >::promoted_type,
+          typename libq::details::sin_of<libq::angle<bits> >::promoted_type>
+    sincos_of_angle(libq::angle<bits> const _angle) {
+    using sin_type =
+        typename libq::details::sin_of<libq::angle<bits> >::promoted_type;
+
+    // the angle is exact, so the work format keeps all the guard bits
+    using precision = libq::details::precision_traits<
+        sin_type::bits_for_fractional,
+        sin_type::bits_for_fractional + 8u>;
+    using work_type = libq::Q<precision::bits_for_fractional + 3u,
+                              precision::bits_for_fractional>;
+
+    std::int64_t const half = std::int64_t(1) << (bits - 3u);
+    std::int64_t const v = static_cast<std::int64_t>(_angle.value()) + half;
+    int const quadrant = static_cast<int>((v >> (bits - 2u)) & 3);
+    std::int64_t const units =
+        (v & ((std::int64_t(1) << (bits - 2u)) - 1)) - half;
+
+    work_type y, x;
+    libq::details::sincos<precision::iterations>(
+        libq::angle<bits>::template radians_of<work_type>(units), y, x);
+
+    switch (quadrant) {
+    case 0:
+        return std::make_pair(sin_type(y), sin_type(x));
+    case 1:
+        return std::make_pair(sin_type(x), sin_type(-y));
+    case 2:
+        return std::make_pair(sin_type(-y), sin_type(-x));
+    default:
+        return std::make_pair(sin_type(-x), sin_type(y));
+    }
+}
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+/*!
+ \brief Computes both sine and cosine of the binary angle by the single
+ CORDIC rotation.
+ \return the pair of the sine and the cosine of type
+ libq::Q<bits - 1, bits - 2>
+ \note The absolute error is bounded by
+ libq::details::precision_traits<bits - 2, bits + 6>::error_bound() plus one
+ ulp of the result.
+*/
+template<std::size_t bits>
+std::pair<typename libq::details::sin_of<libq::angle<bits> >::promoted_type,
+          typename libq::details::cos_of<libq::angle<bits> >::promoted_type>
+    sincos(libq::angle<bits> const _angle) {
+    return libq::details::sincos_of_angle(_angle);
+}
+
+
+/*!
+ \brief Computes the sine of the binary angle, see libq::sincos.
+*/
+template<std::size_t bits>
+typename libq::details::sin_of<libq::angle<bits> >::promoted_type
+    sin(libq::angle<bits> const _angle) {
+    return libq::details::sincos_of_angle(_angle).first;
+}
+
+
+/*!
+ \brief Computes the cosine of the binary angle, see libq::sincos.
+*/
+template<std::size_t bits>
+typename libq::details::cos_of<libq::angle<bits> >::promoted_type
+    cos(libq::angle<bits> const _angle) {
+    return libq::details::sincos_of_angle(_angle).second;
+}
+
+
+/*!
+ \brief Computes the angle of vector (x, y) as the binary angle.
+ \tparam Angle type of the result, libq::angle
+ \details The angle of libq::polar is within \f$[-\pi, \pi]\f$, so it is
+ converted to the fraction of the turn without the reduction.
+*/
+template<class Angle,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+Angle atan2(libq::fixed_point<T, n, f, e, op, up> _y,
+            libq::fixed_point<T, n, f, e, op, up> _x) {
+    enum: std::size_t {
+        bits = boost::static_unsigned_min<Angle::bits_for_angle, f>::value
+    };
+
+    auto const z = libq::polar<bits>(_x, _y).second;
+    return Angle::from_reduced_radians(static_cast<std::int64_t>(z.value()),
+                                       static_cast<int>(f) + e);
+}
+}  // namespace libq
+
+
+namespace std {
+template<std::size_t bits>
+typename libq::details::sin_of<libq::angle<bits> >::promoted_type
+    sin(libq::angle<bits> const _angle) {
+    return libq::sin(_angle);
+}
+
+template<std::size_t bits>
+typename libq::details::cos_of<libq::angle<bits> >::promoted_type
+    cos(libq::angle<bits> const _angle) {
+    return libq::cos(_angle);
+}
+}  // namespace std
+
+#endif  // INC_LIBQ_CORDIC_ANGLE_INL_
@@ -6,13 +6,14 @@
 /*!
  \file asin.inl
 
- Provides CORDIC for tanh function as a ratio of sinh and tanh
+ Provides the double-rotation CORDIC for asin function
  \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
 */
 
 #ifndef INC_STD_ASIN_INL_
 #define INC_STD_ASIN_INL_
 
+#include <limits>
 
 namespace libq {
 namespace details {
@@ -34,18 +35,87 @@ class asin_of<libq::fixed_point<T, n, f, e, op, up> >
                                  0,
                                  0> {
 };
+
+
+/*!
+ \brief Computes the arcsine by the double-rotation CORDIC.
+ \param _t argument from \f$[-1, 1]\f$
+ \details Every iteration rotates the vector (x, y) twice by the same angle
+ \f$\pm\arctan 2^{-i}\f$ towards the target t, see page 6. The gain of the
+ double rotation is exactly \f$1 + 2^{-2i}\f$, so the target is scaled by
+ the shift and the add \f$t + (t \gg 2i)\f$ instead of the multiplication
+ by the tabulated \f$K_i^2\f$.
+ \note The vector and the target grow by
+ \f$\prod_i (1 + 2^{-2i}) < 2.7\f$, so work_type needs 2 bits for the
+ integer part.
+ \ref see C. Mazenc, X. Merrheim, J.-M. Muller, "Computing functions
+ \f$\cos^{-1}\f$ and \f$\sin^{-1}\f$ using CORDIC", 1993
+*/
+template<std::size_t iterations, typename work_type>
+work_type asin_double_rotation(work_type const _t) {
+    using storage_type = typename work_type::storage_type;
+    using lut_type = libq::cordic::lut<iterations, work_type>;
+    enum: std::size_t {
+        digits = std::numeric_limits<storage_type>::digits
+    };
+
+    static lut_type const angles = lut_type::circular();
+
+    storage_type x = work_type(1.0).value();
+    storage_type y(0);
+    storage_type z(0);
+    storage_type t = _t.value();
+
+#ifdef LOOP_UNROLLING
+    auto const iteration_body = [&](std::size_t i) {  // NOLINT
+#else
+    for (std::size_t i = 0u; i != iterations; ++i) {
+#endif
+        int const sign = ((t >= y) != (x < 0)) ? 1 : -1;
+
+        storage_type const x1 = x - sign * (y >> i);
+        storage_type const y1 = y + sign * (x >> i);
+        x = x1 - sign * (y1 >> i);
+        y = y1 + sign * (x1 >> i);
+        z += sign * (angles[i].value() << 1);
+
+        if (2u * i < digits) {
+            t += t >> (2u * i);
+        }
+    };  // NOLINT
+#ifdef LOOP_UNROLLING
+    libq::details::unroll(iteration_body,
+                          0u,
+                          libq::details::loop_size<iterations - 1u>());
+#endif
+
+    return work_type::wrap(z);
+}
 }  // namespace details
 }  // namespace libq
 
 
-namespace std {
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+namespace libq {
+/*!
+ \brief Computes the arcsine by CORDIC with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits the caller needs
+ \note The absolute error is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
 typename libq::details::asin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
     asin(libq::fixed_point<T, n, f, e, op, up> _val) {
     using Q = libq::fixed_point<T, n, f, e, op, up>;
     using result_type = typename libq::details::asin_of<Q>::promoted_type;
-    using lut_type = libq::cordic::lut<result_type::bits_for_fractional,
-                                      result_type>;
+    using precision = libq::details::precision_traits<bits, f>;
+    using work_type = typename libq::details::asin_of<
+        libq::fixed_point<T, n, precision::bits_for_fractional, e, op, up> >::promoted_type;  // NOLINT
 
     assert(("[std::asin] argument is not from [-1.0, 1.0]",
             std::fabs(_val) <= Q(1.0f)));
@@ -60,42 +130,56 @@ typename libq::details::asin_of<libq::fixed_point<T, n, f, e, op, up> >::promote
     } else if (_val == Q(0.0)) {
         return result_type::wrap(0);
     }
-    static lut_type const angles = lut_type::circular();
-    static lut_type const scales = lut_type::circular_scales();
 
-    // rotation mode: see page 6
-    // shift sequence is just 0, 1, ... (circular coordinate system)
-    result_type x(1.0f), y(0.0), z(0.0);
+    return result_type(
+        libq::details::asin_double_rotation<precision::iterations>(
+            work_type(_val)));
+}
+}  // namespace libq
 
-#ifdef LOOP_UNROLLING
-    auto const iteration_body = [&](std::size_t i) {  // NOLINT
-#else
-    for (std::size_t i = 0u; i != f; ++i) {
-#endif
-        int sign(0);
-        if (_val >= y) {
-            sign = (x < 0.0)? -1 : +1;
-        } else {
-            sign = (x < 0.0)? +1 : -1;
-        }
 
-        typename result_type::storage_type const store(x.value());
-        x = x - result_type::wrap(sign * (y.value() >> i));
-        y = y + result_type::wrap(sign * (store >> i));
-        z = (sign > 0)? z + angles[i] : z - angles[i];
-        _val = _val * scales[i];
-    };  // NOLINT
-#ifdef LOOP_UNROLLING
-    libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f - 1>());
-#endif
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the arcsine by the engine.
+*/
+template<class Engine>
+class asin_impl;
 
-    if (z > result_type::CONST_PI_2) {
-        z = result_type::CONST_PI - z;
-    } else if (z < -result_type::CONST_PI_2) {
-        z = -result_type::CONST_PI - z;
+
+template<>
+class asin_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::asin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        return libq::asin<f>(_val);
     }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the arcsine by the chosen engine.
+ \tparam Engine libq::engine::cordic or libq::engine::cordic_radix4
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::asin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    asin(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::asin_impl<Engine>::apply(_val);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::asin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    asin(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::asin>::type;
 
-    return z;
+    return libq::asin<engine_type>(_val);
 }
 }  // namespace std
 
@@ -33,39 +33,85 @@ class atan_of<libq::fixed_point<T, n, f, e, op, up> >
 }  // namespace libq
 
 
-namespace std {
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+namespace libq {
+/*!
+ \brief Computes the arctangent by CORDIC with the reduced number of
+ iterations.
+ \tparam bits number of accurate fractional bits the caller needs
+ \note The absolute error is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
 typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
     atan(libq::fixed_point<T, n, f, e, op, up> _val) {
-    using Q = libq::fixed_point<T, n, f, e, op, up>;
     using result_type =
         typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
-    using lut_type = libq::cordic::lut<f, Q>;
-
-    static lut_type const angles = lut_type::circular();
+    using precision = libq::details::precision_traits<bits, f>;
+    using work_type = typename libq::details::atan_of<
+        libq::fixed_point<T, n, precision::bits_for_fractional, e, op, up> >::promoted_type;  // NOLINT
+    using engine_type = libq::cordic::engine<libq::cordic::vectoring,
+                                             libq::cordic::circular,
+                                             work_type,
+                                             precision::iterations>;
 
     // vectoring mode: see page 10, table 24.2
-    // shift sequence is just 0, 1, ... (circular coordinate system)
-    result_type x(1.0), y(_val), z(0.0);
-
-#ifdef LOOP_UNROLLING
-    auto const iteration_body = [&](std::size_t i) {  // NOLINT
-#else
-    for (std::size_t i = 0u; i != f; ++i) {
-#endif
-        int const sign = ((x.value() > 0)? +1 : -1) *
-            ((y.value() > 0)? +1 : -1);
-
-        typename result_type::storage_type const store(x.value());
-        x = x + result_type::wrap(sign * (y.value() >> i));
-        y = y - result_type::wrap(sign * (store >> i));
-        z = (sign > 0)? z + angles[i] : z - angles[i];
-    };  // NOLINT
-#ifdef LOOP_UNROLLING
-    libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f-1>());
-#endif
-
-    return z;
+    typename engine_type::state_type const state =
+        engine_type::apply(work_type(1.0), work_type(_val), work_type(0.0));
+
+    return result_type(std::get<2>(state));
+}
+}  // namespace libq
+
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the arctangent by the engine.
+*/
+template<class Engine>
+class atan_impl;
+
+
+template<>
+class atan_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        return libq::atan<f>(_val);
+    }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the arctangent by the chosen engine.
+ \tparam Engine libq::engine::cordic, libq::engine::cordic_radix4,
+ libq::engine::polynomial or libq::engine::table
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    atan(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::atan_impl<Engine>::apply(_val);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    atan(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::atan>::type;
+
+    return libq::atan<engine_type>(_val);
 }
 }  // namespace std
 
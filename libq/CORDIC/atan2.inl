@@ -0,0 +1,46 @@
+// atan2.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file atan2.inl
+
+ Provides CORDIC for atan2 function
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_STD_ATAN2_INL_
+#define INC_STD_ATAN2_INL_
+
+namespace libq {
+/*!
+ \brief Computes the angle of vector (x, y) by CORDIC with the reduced number
+ of iterations.
+ \tparam bits number of accurate fractional bits, see libq::polar
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+typename libq::details::atan2_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    atan2(libq::fixed_point<T, n, f, e, op, up> _y,
+          libq::fixed_point<T, n, f, e, op, up> _x) {
+    return libq::polar<bits>(_x, _y).second;
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::atan2_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    atan2(libq::fixed_point<T, n, f, e, op, up> _y,
+          libq::fixed_point<T, n, f, e, op, up> _x) {
+    return libq::atan2<f>(_y, _x);
+}
+}  // namespace std
+
+#endif  // INC_STD_ATAN2_INL_
@@ -0,0 +1,89 @@
+// cbrt.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file cbrt.inl
+
+ Provides CORDIC for cbrt function as \f$\sqrt[3]{x} = 2^{\frac13 \log_2 x}\f$
+*/
+
+#ifndef INC_LIBQ_DETAILS_CBRT_INL_
+#define INC_LIBQ_DETAILS_CBRT_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief The cube root of the fixed-point number fits its format.
+*/
+template<typename T>
+class cbrt_of {
+ public:
+    using promoted_type = T;
+};
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+/*!
+ \brief Computes the cube root with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits of the logarithm
+ \details \f$\sqrt[3]{x} = sign(x) \cdot 2^{\frac13 \log_2 |x|}\f$, where the
+ logarithm is divided by 3 with the floor, so the integer part of the
+ quotient is the binary exponent of the result and the fractional one is left
+ for libq::details::power_of_two.
+ \note The relative error of the result is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+typename libq::details::cbrt_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    cbrt(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using cbrt_type = typename libq::details::cbrt_of<Q>::promoted_type;
+    using precision = libq::details::precision_traits<bits, f>;
+
+    enum: std::size_t {
+        steps = precision::iterations / 2u + 1u
+    };
+
+    std::int64_t const x = static_cast<std::int64_t>(_val.value());
+    if (x == 0) {
+        return cbrt_type(0);
+    }
+    bool const negative = (x < 0);
+
+    // log2|x| with 56 fractional bits divided by 3 with the floor
+    std::int64_t const l = libq::details::binary_logarithm<steps, op, up>(
+        negative ? std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+                   static_cast<std::uint64_t>(x),
+        static_cast<int>(Q::bits_for_fractional) + e);
+    std::int64_t const t = (l >= 0) ? l / 3 : -((2 - l) / 3);
+
+    cbrt_type const r = libq::details::power_of_two<steps, cbrt_type>(
+        t >> 56,
+        (t & ((std::int64_t(1) << 56) - 1)) << 6);
+
+    return negative ? cbrt_type(-r) : r;
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::cbrt_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    cbrt(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::cbrt<f>(_val);
+}
+}  // namespace std
+
+#endif  // INC_LIBQ_DETAILS_CBRT_INL_
@@ -32,72 +32,95 @@ class cos_of<libq::fixed_point<T, n, f, e, op, up> >
 }  // namespace libq
 
 
-namespace std {
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+namespace libq {
+/*!
+ \brief Computes the cosine by CORDIC with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits the caller needs
+ \note The absolute error is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
 typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
-cos(libq::fixed_point<T, n, f, e, op, up> _val) {
-    using Q = libq::fixed_point<T, n, f, e, op, up>;
-    using cos_type = typename libq::details::cos_of<Q>::promoted_type;
+    cos(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using cos_type =
+        typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+    using precision = libq::details::precision_traits<bits, f>;
+    using work_type =
+        libq::Q<precision::bits_for_fractional + 3u,
+                precision::bits_for_fractional, e, op, up>;
 
     // convergence interval for CORDIC rotations is [-pi/2, pi/2].
-    // So one has to map input angle to that interval
-    Q arg(0);
-    int sign(-1);
-
-    // put argument to [-pi, pi] interval (with change of sign for cos)
-    {
-        Q const x = Q::CONST_PI - std::fmod(_val, Q::CONST_2PI);
-        if (x < -Q::CONST_PI_2) {  // convert to interval [-pi/2, pi/2]
-            arg = x + Q::CONST_PI;
-
-            sign = 1;
-        }
-        else if (x > Q::CONST_PI_2) {
-            arg = x - Q::CONST_PI;
-
-            sign = 1;
-        }
-        else {
-            arg = x;
-        }
+    // So x = k * pi/2 + r, where r is from [-pi/4, pi/4], and
+    // cos(x) is one of cos(r), -sin(r), -cos(r), sin(r) depending on k mod 4
+    work_type arg(0);
+    int const quadrant = libq::details::reduce_angle(_val, arg);
+
+    work_type y, x;
+    libq::details::sincos<precision::iterations>(arg, y, x);
+
+    switch (quadrant) {
+    case 0:
+        return cos_type(x);
+    case 1:
+        return cos_type(-y);
+    case 2:
+        return cos_type(-x);
+    default:
+        return cos_type(y);
     }
+}
+}  // namespace libq
+
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the cosine by the engine.
+*/
+template<class Engine>
+class cos_impl;
+
+
+template<>
+class cos_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        return libq::cos<f>(_val);
+    }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the cosine by the chosen engine.
+ \tparam Engine libq::engine::cordic, libq::engine::cordic_radix4,
+ libq::engine::polynomial or libq::engine::table
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    cos(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::cos_impl<Engine>::apply(_val);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    cos(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::cos>::type;
 
-    using lut_type = libq::cordic::lut<f, Q>;
-    static lut_type const angles = lut_type::circular();
-
-    // normalization factor: see page 10, table 24.1 and pages 4-5, equations
-    // (5)-(6)
-    // factor converges to the limit 1.64676 very fast: it takes 8 iterations
-    // only. 8 iterations corresponds to precision of size 0.007812 for
-    // angle approximation
-    static Q norm_factor(1.0 / lut_type::circular_scale(f));
-
-    // rotation mode: see page 6
-    // shift sequence is just 0, 1, ... (circular coordinate system)
-    Q x(norm_factor), y(0.0), z(arg);
-    Q x1, y1, z1;
-
-#ifdef LOOP_UNROLLING
-    auto const iteration_body = [&](std::size_t i) {  // NOLINT
-#else
-    for (std::size_t i = 0u; i != f; ++i) {
-#endif
-        int const sign = (z > Q(0)) ? 1 : -1;
-
-        Q const x_scaled = Q::wrap(sign * (x.value() >> i));
-        Q const y_scaled = Q::wrap(sign * (y.value() >> i));
-
-        x1 = Q(x - y_scaled);
-        y1 = Q(y + x_scaled);
-        z1 = Q(z - Q((sign > 0) ? angles[i] : -angles[i]));
-
-        x = x1; y = y1; z = z1;
-    };  // NOLINT
-#ifdef LOOP_UNROLLING
-    libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f-1>());
-#endif
-
-    return cos_type((sign > 0) ? x : - x);
+    return libq::cos<engine_type>(_val);
 }
 }  // namespace std
 
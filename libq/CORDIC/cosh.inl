@@ -6,27 +6,38 @@
 /*!
  \file cosh.inl
 
- Provides CORDIC for cosh function as a sum of exponents
-
- \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures" and
- J.S. Walther, "A Unified Algorithm for Elementary Functions"
+ Provides CORDIC for cosh function
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
 */
 
 #ifndef INC_LIBQ_DETAILS_COSH_INL_
 #define INC_LIBQ_DETAILS_COSH_INL_
 
-namespace std {
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+namespace libq {
+/*!
+ \brief Computes the hyperbolic cosine by CORDIC with the reduced number of
+ iterations.
+ \tparam bits number of accurate fractional bits, see libq::sinhcosh
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
 typename libq::details::sinh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
     cosh(libq::fixed_point<T, n, f, e, op, up> _val) {
-    using Q = libq::fixed_point<T, n, f, e, op, up>;
-    using cosh_type = typename libq::details::sinh_of<Q>::promoted_type;
+    return libq::sinhcosh<bits>(_val).second;
+}
+}  // namespace libq
 
-    auto x = static_cast<cosh_type>(std::exp(_val)) +
-        static_cast<cosh_type>(std::exp(-_val));
-    libq::lift(x) >>= 1u;
 
-    return x;
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::sinh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    cosh(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::cosh<f>(_val);
 }
 }  // namespace std
 
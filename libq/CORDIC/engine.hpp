@@ -0,0 +1,354 @@
+// engine.hpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file engine.hpp
+
+ Provides the generic CORDIC engine: rotation and vectoring modes in
+ circular, linear and hyperbolic coordinates. The rotations and vectorings
+ of libq/CORDIC are built on top of it.
+
+ \ref See H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures".
+*/
+
+#ifndef INC_LIBQ_CORDIC_ENGINE_HPP_
+#define INC_LIBQ_CORDIC_ENGINE_HPP_
+
+#include <array>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace libq {
+namespace cordic {
+/*!
+ \brief Rotation mode: rotates the vector (x, y) by the angle z, z is driven
+ to zero.
+*/
+class rotation {
+};
+
+/*!
+ \brief Vectoring mode: rotates the vector (x, y) to the x-axis, y is driven
+ to zero and z accumulates the angle of the vector.
+*/
+class vectoring {
+};
+
+/*!
+ \brief Circular coordinates, m = 1: the shift sequence is 0, 1, 2, ...
+*/
+class circular {
+};
+
+/*!
+ \brief Linear coordinates, m = 0: the shift sequence is 0, 1, 2, ...
+*/
+class linear {
+};
+
+/*!
+ \brief Hyperbolic coordinates, m = -1: the shift sequence is 1, 2, 3, ...,
+ shifts 4, 13, 40, ... are repeated for convergence.
+*/
+class hyperbolic {
+};
+
+
+/*!
+ \brief Describes the coordinate system: the shift sequence, the angles and
+ the gain of iterations CORDIC steps. repeated_steps is the number of the
+ steps repeated for convergence.
+ \ref See page 5, equation 7 and page 10, table 24.1.
+*/
+template<class Coordinates, typename Q, std::size_t iterations>
+class coordinates_traits;
+
+template<typename Q, std::size_t iterations>
+class coordinates_traits<libq::cordic::circular, Q, iterations> {
+    using lut_type = libq::cordic::lut<iterations, Q>;
+
+ public:
+    enum: int { m = 1 };
+    enum: std::size_t { repeated_steps = 0u };
+
+    static std::size_t shift(std::size_t const _i) { return _i; }
+    static bool is_repeated(std::size_t const) { return false; }
+
+    static lut_type angles() { return lut_type::circular(); }
+    static double gain() { return lut_type::circular_scale(iterations); }
+};
+
+template<typename Q, std::size_t iterations>
+class coordinates_traits<libq::cordic::linear, Q, iterations> {
+    using lut_type = libq::cordic::lut<iterations, Q>;
+
+ public:
+    enum: int { m = 0 };
+    enum: std::size_t { repeated_steps = 0u };
+
+    static std::size_t shift(std::size_t const _i) { return _i; }
+    static bool is_repeated(std::size_t const) { return false; }
+
+    static lut_type angles() { return lut_type::linear(); }
+    static double gain() { return 1.0; }
+};
+
+template<typename Q, std::size_t iterations>
+class coordinates_traits<libq::cordic::hyperbolic, Q, iterations> {
+    using lut_type = libq::cordic::lut<iterations, Q>;
+
+ public:
+    enum: int { m = -1 };
+    enum: std::size_t {
+        repeated_steps = (iterations >= 4u) + (iterations >= 13u) +
+            (iterations >= 40u)
+    };
+
+    static std::size_t shift(std::size_t const _i) { return _i + 1u; }
+
+    /*!
+     \brief Checks if the shift belongs to 4, 13, 40, ..., i.e.
+     \f$2 \cdot shift + 1\f$ is a power of 3.
+    */
+    static bool is_repeated(std::size_t const _shift) {
+        std::size_t repeated(4u);
+        while (repeated < _shift) {
+            repeated = 3u * repeated + 1u;
+        }
+
+        return repeated == _shift;
+    }
+
+    static lut_type angles() {
+        return lut_type::hyperbolic_wo_repeated_iterations();
+    }
+    static double gain() { return lut_type::hyperbolic_scale(iterations); }
+};
+
+
+/*!
+ \brief Describes how the mode chooses the direction of the next rotation.
+*/
+template<class Mode>
+class mode_traits;
+
+template<>
+class mode_traits<libq::cordic::rotation> {
+ public:
+    template<typename Q>
+    static int direction(Q const&, Q const&, Q const& _z) {
+        return (_z.value() < 0) ? -1 : 1;
+    }
+};
+
+template<>
+class mode_traits<libq::cordic::vectoring> {
+ public:
+    template<typename Q>
+    static int direction(Q const& _x, Q const& _y, Q const&) {
+        return ((_x.value() < 0) == (_y.value() < 0)) ? -1 : 1;
+    }
+};
+
+
+/*!
+ \brief Runs iterations CORDIC steps and returns the full (x, y, z) state.
+ \tparam Mode libq::cordic::rotation or libq::cordic::vectoring
+ \tparam Coordinates libq::cordic::circular, libq::cordic::linear or
+ libq::cordic::hyperbolic
+ \tparam Q fixed-point type of x, y and z: it must keep the gain and the
+ convergence interval of the angle
+ \tparam iterations number of steps, the repeated hyperbolic ones are not
+ counted
+ \details The step \f$i\f$ with the direction \f$d_i = \pm 1\f$ is
+ \f[
+    x' = x - m d_i 2^{-s_i} y, \quad
+    y' = y + d_i 2^{-s_i} x, \quad
+    z' = z - d_i e_i
+ \f]
+ where \f$s_i\f$ is the shift and \f$e_i\f$ is the angle of the coordinate
+ system. The engine does not compensate the gain: the vector (x, y) is
+ scaled by gain().
+
+ <B>Usage</B>
+ \code{.cpp}
+    using Q = libq::Q<31, 28>;
+    using engine = libq::cordic::engine<libq::cordic::vectoring,
+                                        libq::cordic::circular,
+                                        Q,
+                                        30u>;
+
+    // magnitude * gain and the angle of the vector (0.3, 0.4)
+    auto const state = engine::apply(Q(0.3), Q(0.4), Q(0.0));
+    double const r = static_cast<double>(std::get<0>(state)) / engine::gain();
+    double const phi = static_cast<double>(std::get<2>(state));
+ \endcode
+*/
+template<class Mode, class Coordinates, typename Q, std::size_t iterations>
+class engine {
+    using this_class = engine<Mode, Coordinates, Q, iterations>;
+    using traits = libq::cordic::coordinates_traits<Coordinates, Q, iterations>;  // NOLINT
+    using storage_type = typename Q::storage_type;
+
+    static_assert(iterations > 0u, "CORDIC needs one step at least");
+    static_assert(iterations < static_cast<std::size_t>(
+                      std::numeric_limits<storage_type>::digits),
+                  "shifts must be less than the width of the format");
+
+ public:
+    using state_type = std::tuple<Q, Q, Q>;
+    using lut_type = libq::cordic::lut<iterations, Q>;
+
+    enum: std::size_t {
+        steps = iterations + traits::repeated_steps  ///< with repeated ones
+    };
+
+    /*!
+     \brief Directions of all the steps, see directions().
+    */
+    using directions_type = std::array<int, steps>;
+
+    /*!
+     \brief Gets the gain of (x, y) after all the steps.
+    */
+    static double gain() { return traits::gain(); }
+
+    static state_type apply(Q _x, Q _y, Q _z) {
+        static lut_type const angles = traits::angles();
+        std::size_t k(0u);
+
+#ifdef LOOP_UNROLLING
+        auto const iteration_body = [&](std::size_t i) {  // NOLINT
+#else
+        for (std::size_t i = 0u; i != iterations; ++i) {
+#endif
+            std::size_t const shift = traits::shift(i);
+            std::size_t const repeats = traits::is_repeated(shift) ? 2u : 1u;
+
+            for (std::size_t const last = k + repeats; k != last; ++k) {
+                int const direction =
+                    libq::cordic::mode_traits<Mode>::direction(_x, _y, _z);
+
+                this_class::step(_x, _y, shift, direction);
+                _z = this_class::accumulate(_z, angles[i].value(), -direction);  // NOLINT
+            }
+        };  // NOLINT
+#ifdef LOOP_UNROLLING
+        libq::details::unroll(iteration_body,
+                              0u,
+                              libq::details::loop_size<iterations - 1u>());
+#endif
+
+        return state_type(_x, _y, _z);
+    }
+
+    /*!
+     \brief Gets the directions of the rotation by the angle z.
+     \details The rotation mode chooses the directions by z only, so the
+     vectors rotated by the same angle share them: the angle is resolved
+     once, see apply(x, y, directions).
+    */
+    static directions_type directions(Q _z) {
+        static_assert(std::is_same<Mode, libq::cordic::rotation>::value,
+                      "only the rotation mode does not depend on (x, y)");
+
+        static lut_type const angles = traits::angles();
+        directions_type result;
+        std::size_t k(0u);
+
+        for (std::size_t i = 0u; i != iterations; ++i) {
+            std::size_t const repeats =
+                traits::is_repeated(traits::shift(i)) ? 2u : 1u;
+
+            for (std::size_t const last = k + repeats; k != last; ++k) {
+                result[k] = libq::cordic::mode_traits<Mode>::direction(_z, _z, _z);  // NOLINT
+                _z = this_class::accumulate(_z, angles[i].value(), -result[k]);  // NOLINT
+            }
+        }
+
+        return result;
+    }
+
+    /*!
+     \brief Rotates (x, y) by the directions found by directions(z).
+     \return the pair of x and y, the same as the ones of apply(x, y, z)
+    */
+    static std::pair<Q, Q> apply(Q _x,
+                                 Q _y,
+                                 directions_type const& _directions) {
+        std::size_t k(0u);
+
+#ifdef LOOP_UNROLLING
+        auto const iteration_body = [&](std::size_t i) {  // NOLINT
+#else
+        for (std::size_t i = 0u; i != iterations; ++i) {
+#endif
+            std::size_t const shift = traits::shift(i);
+            std::size_t const repeats = traits::is_repeated(shift) ? 2u : 1u;
+
+            for (std::size_t const last = k + repeats; k != last; ++k) {
+                this_class::step(_x, _y, shift, _directions[k]);
+            }
+        };  // NOLINT
+#ifdef LOOP_UNROLLING
+        libq::details::unroll(iteration_body,
+                              0u,
+                              libq::details::loop_size<iterations - 1u>());
+#endif
+
+        return std::make_pair(_x, _y);
+    }
+
+ private:
+    /*!
+     \brief Gets \f$a + d b\f$ for the direction \f$d = \pm 1\f$ in the
+     storage of Q.
+     \details The sum wraps around modulo the width of the storage like the
+     conversion of the promoted sum did, so the step never takes the wider
+     integers: the 32-bit work types are computed in 32 bits. The overflow
+     policy is raised if the sum does not fit the storage.
+    */
+    static Q accumulate(Q const _a,
+                        storage_type const _b,
+                        int const _direction) {
+        using unsigned_type = typename std::make_unsigned<storage_type>::type;
+
+        storage_type const a = _a.value();
+        storage_type const sum = static_cast<storage_type>((_direction > 0) ?
+            static_cast<unsigned_type>(a) + static_cast<unsigned_type>(_b) :
+            static_cast<unsigned_type>(a) - static_cast<unsigned_type>(_b));
+
+        if (Q::overflow_policy::does_throw) {
+            bool const overflow = std::is_signed<storage_type>::value ?
+                (((_direction > 0) ? ((a ^ sum) & (_b ^ sum)) :
+                                     ((a ^ _b) & (a ^ sum))) < 0) :
+                ((_direction > 0) ? (sum < a) : (a < _b));
+            if (overflow) {
+                Q::overflow_policy::raise_event();
+            }
+        }
+
+        return Q::wrap(sum);
+    }
+
+    static void step(Q& _x,
+                     Q& _y,
+                     std::size_t const _shift,
+                     int const _direction) {
+        storage_type const x_shifted = _x.value() >> _shift;
+        storage_type const y_shifted = _y.value() >> _shift;
+
+        if (traits::m != 0) {
+            _x = this_class::accumulate(_x, y_shifted, -traits::m * _direction);  // NOLINT
+        }
+        _y = this_class::accumulate(_y, x_shifted, _direction);
+    }
+};
+}  // namespace cordic
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_ENGINE_HPP_
@@ -6,93 +6,150 @@
 /*!
  \file exp.inl
 
- Provides CORDIC for exp function
+ Provides the shift-and-add algorithm for exp function
 
- \ref see C. Baumann, "A simple and fast look-up table method to compute the
- exp(x) and ln(x) functions", 2004
+ \ref see J.-M. Muller, "Elementary Functions: Algorithms and
+ Implementation", chapter 8
 */
 
 #ifndef INC_LIBQ_DETAILS_EXP_INL_
 #define INC_LIBQ_DETAILS_EXP_INL_
 
-#include <limits>
+#include <cstdint>
 
 namespace libq {
-namespace details {
 /*!
+ \brief Computes the exponent with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits of the exponent's argument
+ \details Multiplicative normalization:
+ 1. The argument is reduced to \f$x = k \ln 2 + r\f$, \f$r \in [0, \ln 2)\f$,
+ see libq::details::reduce.
+ 2. Every step with \f$r \geq \ln(1 + 2^{-i})\f$ subtracts the logarithm
+ from r and multiplies the result by \f$1 + 2^{-i}\f$, i.e. the stored
+ integer y is increased by \f$y \gg i\f$. So the step is the shift and the
+ add.
+ 3. The residual \f$r < 2^{-m}\f$ after m steps gives
+ \f$e^r = 1 + r + O(2^{-2m})\f$: the single multiplication replaces the
+ second half of the steps.
+ 4. The result \f$2^k e^r\f$ is rounded like the one of libq::exp2, see
+ libq::details::scale_by_power_of_two: the overflow is raised by the
+ overflow policy and the result is saturated.
+ \note The relative error of the result is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
 */
-template<typename T>
-class exp_of {
- public:
-    using promoted_type = T;
-};
-
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
-class exp_of<libq::fixed_point<T, n, f, e, op, up> > {
- public:
-    using promoted_type = libq::fixed_point<
-                               std::uintmax_t,
-                               std::numeric_limits<std::uintmax_t>::digits - f,
-                               f,
-                               e,
-                               op,
-                               up>;
-};
-}  // namespace details
-}  // namespace libq
-
-namespace std {
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
 typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
     exp(libq::fixed_point<T, n, f, e, op, up> _val) {
     using Q = libq::fixed_point<T, n, f, e, op, up>;
     using exp_type = typename libq::details::exp_of<Q>::promoted_type;
-
-    using Qw = libq::Q<f, f, e, op, up>;
-    using work_type =
-        typename libq::details::type_promotion_base<Qw, 1u, 0, 0>::promoted_type;  // NOLINT
-    using lut_type = libq::cordic::lut<f, work_type>;
-
-    // reduces argument to interval [0.0, 1.0]
-    int power(0);
-    typename libq::details::mult_of<Q, work_type>::promoted_type
-        arg(_val * work_type::CONST_LOG2E);
-    while (arg >= exp_type(1.0)) {
-        arg = arg - 1u;
-        power++;
-    }
-    while (arg < exp_type(0.0)) {
-        arg = arg + 1u;
-        power--;
+    using precision = libq::details::precision_traits<bits, f>;
+
+    // r from [0, ln(2)) needs no bits for the integer part
+    using work_type = libq::Q<precision::bits_for_fractional + 1u,
+                              precision::bits_for_fractional,
+                              0,
+                              op,
+                              up>;
+    enum: std::size_t {
+        steps = precision::iterations / 2u + 1u
+    };
+    enum: int {
+        fractional = static_cast<int>(work_type::bits_for_fractional)
+    };
+    using lut_type = libq::cordic::lut<steps, work_type>;
+
+    static lut_type const logs = lut_type::log_one_plus();
+    static libq::details::scaled_constant<libq::details::ln2_constant,
+                                          work_type::bits_for_fractional> const ln2;  // NOLINT
+
+    work_type arg(0);
+    std::int64_t k =
+        libq::details::reduce<libq::details::ln2_constant>(_val, arg);
+    std::int64_t r = static_cast<std::int64_t>(arg.value());
+    if (r < 0) {
+        r += ln2.hi;
+        --k;
     }
 
-    static lut_type const pow2_lut = lut_type::pow2();
-    exp_type result(1.0);
-    work_type x(arg);
+    // e^r from [1, 2) with 62 fractional bits
+    std::uint64_t y = std::uint64_t(1u) << 62;
 
 #ifdef LOOP_UNROLLING
     auto const iteration_body = [&](std::size_t i) {  // NOLINT
 #else
-    for (std::size_t i = 0u; i != f; ++i) {
+    for (std::size_t i = 0u; i != steps; ++i) {
 #endif
-        work_type const pow2 = work_type::wrap(T(1u) << (f - i - 1u));
-
-        if (x - pow2 >= work_type(0.0)) {
-            x = x - pow2;
-
-            result *= pow2_lut[i];
+        std::int64_t const l = static_cast<std::int64_t>(logs[i].value());
+        if (r >= l) {
+            r -= l;
+            y += y >> (i + 1u);
         }
     };  // NOLINT
 #ifdef LOOP_UNROLLING
-    libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f-1>());
+    libq::details::unroll(iteration_body,
+                          0u,
+                          libq::details::loop_size<steps - 1u>());
 #endif
 
-    if (power >= 0) {
-        libq::lift(result) <<= power;
-    } else {
-        libq::lift(result) >>= (-power);
+    // e^r = 1 + r for the residual, r is non-negative here
+    y += libq::details::mulhi(y, static_cast<std::uint64_t>(r) <<
+                                     (64 - fractional));
+
+    // y * 2^k in the format of the result
+    return libq::details::scale_by_power_of_two<exp_type>(y, k);
+}
+}  // namespace libq
+
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the exponent by the engine.
+*/
+template<class Engine>
+class exp_impl;
+
+
+template<>
+class exp_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        return libq::exp<f>(_val);
     }
-    return result;
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the exponent by the chosen engine.
+ \tparam Engine libq::engine::cordic, libq::engine::polynomial or
+ libq::engine::table
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    exp(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::exp_impl<Engine>::apply(_val);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    exp(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::exp>::type;
+
+    return libq::exp<engine_type>(_val);
 }
 }  // namespace std
 
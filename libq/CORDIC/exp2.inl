@@ -0,0 +1,192 @@
+// exp2.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file exp2.inl
+
+ Provides CORDIC for exp2 function
+
+ \ref see C. Baumann, "A simple and fast look-up table method to compute the
+ exp(x) and ln(x) functions", 2004
+*/
+
+#ifndef INC_LIBQ_DETAILS_EXP2_INL_
+#define INC_LIBQ_DETAILS_EXP2_INL_
+
+#include <cstdint>
+#include <limits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the format of the exponents of the fixed-point numbers.
+ \note The exponent is positive and it grows fast, so the result keeps the
+ fractional bits of the argument and takes all the rest of the widest
+ unsigned type for the integer part.
+*/
+template<typename T>
+class exp_of {
+ public:
+    using promoted_type = T;
+};
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class exp_of<libq::fixed_point<T, n, f, e, op, up> > {
+ public:
+    using promoted_type = libq::fixed_point<
+                               std::uintmax_t,
+                               std::numeric_limits<std::uintmax_t>::digits - f,
+                               f,
+                               e,
+                               op,
+                               up>;
+};
+
+
+/*!
+ \brief Rounds \f$y 2^p\f$ to the format R for the mantissa
+ \f$y \in [1, 2)\f$ with 62 fractional bits.
+ \details The result is zero if it is less than the half of ulp. The
+ overflow is raised by the overflow policy of R and the result is saturated
+ then.
+*/
+template<typename R>
+R scale_by_power_of_two(std::uint64_t const _y, std::int64_t const _power) {
+    // the exponents beyond the 64-bit range are clamped before the shift is
+    // computed
+    int const power = static_cast<int>(
+        (_power > 128) ? 128 : ((_power < -128) ? -128 : _power));
+    int const shift = 62 - static_cast<int>(R::bits_for_fractional) -
+        R::scaling_factor_exponent - power;
+
+    if (shift >= 64) {
+        return R::wrap(0);
+    }
+
+    // y is less than 2^63, so it is shifted left by 1 bit at most
+    bool overflow = (shift < -1);
+    std::uint64_t result(0u);
+    if (shift > 0) {
+        result = (_y + (std::uint64_t(1u) << (shift - 1))) >> shift;
+    } else if (!overflow) {
+        result = _y << (-shift);
+        overflow = ((result >> (-shift)) != _y);
+    }
+
+    std::uint64_t const largest = libq::details::largest_stored<R>();
+    if (overflow || result > largest) {
+        R::overflow_policy::raise_event();
+        result = largest;
+    }
+
+    return R::wrap(static_cast<typename R::storage_type>(result));
+}
+
+
+/*!
+ \brief Computes \f$2^{p + r}\f$ in the format R for the integer p and
+ \f$r \in [0, 1)\f$ with 62 fractional bits.
+ \details Multiplicative normalization like libq::exp does, but the LUT is
+ \f$\log_2(1 + 2^{-i})\f$, so no constant multiplication is needed:
+ 1. Every step with \f$r \geq \log_2(1 + 2^{-i})\f$ subtracts the logarithm
+ from r and adds \f$y \gg i\f$ to the mantissa y.
+ 2. The residual \f$r < 2^{-m}\f$ after m steps gives
+ \f$2^r = 1 + r \ln 2 + O(2^{-2m})\f$.
+ 3. The mantissa is shifted by p to the format of the result and rounded,
+ see libq::details::scale_by_power_of_two.
+*/
+template<std::size_t steps, typename R>
+R power_of_two(std::int64_t _power, std::int64_t _fraction) {
+    using work_type = libq::Q<63u,
+                              62u,
+                              0,
+                              typename R::overflow_policy,
+                              typename R::underflow_policy>;
+    using lut_type = libq::cordic::lut<steps, work_type>;
+
+    static lut_type const logs = lut_type::log2_one_plus();
+
+    // 2^r from [1, 2) with 62 fractional bits
+    std::uint64_t y = std::uint64_t(1u) << 62;
+
+#ifdef LOOP_UNROLLING
+    auto const iteration_body = [&](std::size_t i) {  // NOLINT
+#else
+    for (std::size_t i = 0u; i != steps; ++i) {
+#endif
+        std::int64_t const l = static_cast<std::int64_t>(logs[i].value());
+        if (_fraction >= l) {
+            _fraction -= l;
+            y += y >> (i + 1u);
+        }
+    };  // NOLINT
+#ifdef LOOP_UNROLLING
+    libq::details::unroll(iteration_body,
+                          0u,
+                          libq::details::loop_size<steps - 1u>());
+#endif
+
+    // 2^r = 1 + r * ln(2) for the residual, r is non-negative here
+    std::int64_t const residual = libq::details::mulshift(
+        _fraction,
+        static_cast<std::int64_t>(work_type::CONST_LN2.value()),
+        62u);
+    y += libq::details::mulhi(y, static_cast<std::uint64_t>(residual) << 2);
+
+    return libq::details::scale_by_power_of_two<R>(y, _power);
+}
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+/*!
+ \brief Computes the power of two with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits of the exponent's argument
+ \details The integer part of the argument is the binary exponent of the
+ result and it is split off by a shift, see libq::details::power_of_two.
+ \note The relative error of the result is bounded by
+ \f$\ln 2 \cdot\f$ libq::details::precision_traits<bits, f>::error_bound().
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    exp2(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using exp_type = typename libq::details::exp_of<Q>::promoted_type;
+    using precision = libq::details::precision_traits<bits, f>;
+
+    // reduces argument to interval [0.0, 1.0): the integer part of argument
+    // is the binary exponent and the fractional one is left for the steps
+    std::size_t const fraction_bits = Q::bits_for_fractional + e;
+    std::int64_t const value = static_cast<std::int64_t>(_val.value());
+    std::int64_t const power = value >> fraction_bits;
+    std::uint64_t const fraction = static_cast<std::uint64_t>(value) &
+        ((std::uint64_t(1u) << fraction_bits) - 1u);
+
+    return libq::details::power_of_two<precision::iterations / 2u + 1u,
+                                       exp_type>(
+        power,
+        static_cast<std::int64_t>((fraction_bits <= 62u) ?
+                                      fraction << (62u - fraction_bits) :
+                                      fraction >> (fraction_bits - 62u)));
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    exp2(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::exp2<f>(_val);
+}
+}  // namespace std
+
+#endif  // INC_LIBQ_DETAILS_EXP2_INL_
@@ -0,0 +1,48 @@
+// hypot.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file hypot.inl
+
+ Provides CORDIC for hypot function
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_STD_HYPOT_INL_
+#define INC_STD_HYPOT_INL_
+
+namespace libq {
+/*!
+ \brief Computes the magnitude of vector (x, y) by CORDIC with the reduced
+ number of iterations.
+ \tparam bits number of accurate fractional bits, see libq::polar
+ \note This does not need the squares of coordinates, so no wide
+ intermediate format is required.
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+typename libq::details::hypot_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    hypot(libq::fixed_point<T, n, f, e, op, up> _x,
+          libq::fixed_point<T, n, f, e, op, up> _y) {
+    return libq::polar<bits>(_x, _y).first;
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::hypot_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    hypot(libq::fixed_point<T, n, f, e, op, up> _x,
+          libq::fixed_point<T, n, f, e, op, up> _y) {
+    return libq::hypot<f>(_x, _y);
+}
+}  // namespace std
+
+#endif  // INC_STD_HYPOT_INL_
@@ -6,96 +6,160 @@
 /*!
  \file log.inl
 
- Provides CORDIC for ln function
- \ref see C. Baumann, "A simple and fast look-up table method to compute the
- exp(x) and ln(x) functions", 2004
+ Provides the shift-and-add algorithm for ln function
+ \ref see J.-M. Muller, "Elementary Functions: Algorithms and
+ Implementation", chapter 8
 */
 
 #ifndef INC_STD_LOG_INL_
 #define INC_STD_LOG_INL_
 
-#include <boost/integer/static_min_max.hpp>
-#include <boost/integer/static_log2.hpp>
-
 #include <cassert>
+#include <cstdint>
+#include <stdexcept>
 
 namespace libq {
-namespace details {
 /*!
- \brief
- \note 
+ \brief Computes the natural logarithm with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits the caller needs
+ \details Multiplicative normalization:
+ 1. The argument is normalized to \f$x \in [0.5, 1)\f$ by the position of
+ its leading bit p, so \f$\ln(x \cdot 2^p) = \ln x + p \ln 2\f$.
+ 2. Every step with \f$x (1 + 2^{-i}) \leq 1\f$ multiplies x by
+ \f$1 + 2^{-i}\f$, i.e. adds \f$x \gg i\f$ to the stored integer, and
+ subtracts \f$\ln(1 + 2^{-i})\f$ from the result. So the step is the shift
+ and the add. The product of all the factors exceeds 2, so x converges to 1.
+ 3. The residual \f$x > 1 - 2^{-m}\f$ after m steps gives
+ \f$\ln x = (x - 1) + O(2^{-2m})\f$, so the second half of the steps is not
+ needed.
+ \note The absolute error is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
 */
-template<typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
-class log_of
-    : public type_promotion_base<
-        fixed_point<typename std::make_signed<T>::type, n, f, e, op, up>
-        , boost::static_unsigned_max<
-                      (f > 0) ? (boost::static_log2<f>::value) : 0,
-                      (n > 0) ? (boost::static_log2<n>::value) : 0>::value + 1u
-        , 0
-        , 0> {
-};
-}  // namespace details
-}  // namespace libq
-
-
-namespace std {
-template<typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         typename op,
+         typename up>
 typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
     log(libq::fixed_point<T, n, f, e, op, up> _val) {
     using Q = libq::fixed_point<T, n, f, e, op, up>;
     using log_type =
         typename libq::details::log_of<T, n, f, e, op, up>::promoted_type;
-    using lut = libq::cordic::lut<f, Q>;
-
-    assert(("[std::log] argument is negaitve", _val >= Q(0)));
+    using precision = libq::details::precision_traits<bits, f>;
+
+    // logarithms are accumulated with 56 fractional bits: the binary
+    // exponent p is less than 2^7 in magnitude, so p * ln(2) fits as well
+    using work_type = libq::Q<57u, 56u, 0, op, up>;
+    enum: std::size_t {
+        steps = precision::iterations / 2u + 1u
+    };
+    enum: int {
+        fractional = static_cast<int>(work_type::bits_for_fractional),
+        result_fractional = static_cast<int>(log_type::bits_for_fractional) +
+            log_type::scaling_factor_exponent
+    };
+    using lut_type = libq::cordic::lut<steps, work_type>;
+
+    assert(("[std::log] argument is negative", _val > Q(0)));
     if (_val <= Q(0)) {
         throw std::logic_error("[std::log]: argument is negative");
     }
 
-    // one need 1 bit to represent integer part of reals from [1.0, 2.0]
-    using work_type = libq::UQ<f + 1u, f, 0, op, up>;
+    static lut_type const logs = lut_type::log_one_plus();
+    static libq::details::scaled_constant<libq::details::ln2_constant,
+                                          work_type::bits_for_fractional> const ln2;  // NOLINT
 
-    // reduces argument to interval [1.0, 2.0]
-    int power(0);
-    Q arg(_val);
-    while (arg >= Q(2.0)) {
-        libq::lift(arg) >>= 1u;
-        power++;
-    }
-    while (arg < Q(1.0)) {
-        libq::lift(arg) <<= 1u;
-        power--;
-    }
-
-    // one can consider 0 < y = log(2, x) < 1 as x = 2^y
-    // so CORDIC rotation is just a multiplication by 2^{1/2^i}:
-    // 2^y = 2^{a1/2} * 2^{a2/4} * ... * 2^{ai/2^i}, where ai is from
-    // {0, 1}
-    static libq::cordic::lut<f, Q> const inv_pow2_lut = lut::inv_pow2();
+    // x from [0.5, 1) with 62 fractional bits
+    std::uint64_t const value = static_cast<std::uint64_t>(_val.value());
+    int const leading = libq::details::msb(value);
+    int const power =
+        leading + 1 - static_cast<int>(Q::bits_for_fractional) - e;
+    std::uint64_t x = (leading <= 61) ? value << (61 - leading) :
+                                        value >> (leading - 61);
 
-    work_type result(0);
+    std::int64_t result(0);
 
 #ifdef LOOP_UNROLLING
     auto const iteration_body = [&](std::size_t i) {  // NOLINT
 #else
-    for (std::size_t i = 0; i != f; ++i) {
+    for (std::size_t i = 0u; i != steps; ++i) {
 #endif
-        if (work_type(arg * inv_pow2_lut[i]) >= work_type(1.0)) {
-            arg = work_type(arg * inv_pow2_lut[i]);
-
-            libq::lift(result) +=
-                typename work_type::storage_type(1u) << (f - i - 1u);
+        std::uint64_t const candidate = x + (x >> (i + 1u));
+        if (candidate <= (std::uint64_t(1u) << 62)) {
+            x = candidate;
+            result -= static_cast<std::int64_t>(logs[i].value());
         }
     };  // NOLINT
 #ifdef LOOP_UNROLLING
-    libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f-1>());
+    libq::details::unroll(iteration_body,
+                          0u,
+                          libq::details::loop_size<steps - 1u>());
 #endif
 
-    log_type const r0(log_type(result) + log_type(power));
-    log_type const r1(r0 * work_type::CONST_1_LOG2E);
+    // ln(x) = x - 1 for the residual
+    result -= static_cast<std::int64_t>(
+        ((std::uint64_t(1u) << 62) - x) >> (62 - fractional));
+    result += power * ln2.hi;
+
+    // rounds to the format of the result
+    int const shift = fractional - result_fractional;
+    if (shift > 0) {
+        result = (result + (std::int64_t(1) << (shift - 1))) >> shift;
+    } else {
+        result <<= (-shift);
+    }
+
+    return log_type::wrap(
+        static_cast<typename log_type::storage_type>(result));
+}
+}  // namespace libq
+
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the natural logarithm by the engine.
+*/
+template<class Engine>
+class log_impl;
+
+
+template<>
+class log_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
+    static typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        return libq::log<f>(_val);
+    }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the natural logarithm by the chosen engine.
+ \tparam Engine libq::engine::cordic, libq::engine::polynomial or
+ libq::engine::table
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
+typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
+    log(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::log_impl<Engine>::apply(_val);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
+typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
+    log(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::log>::type;
 
-    return r1;
+    return libq::log<engine_type>(_val);
 }
 }  // namespace std
 
@@ -0,0 +1,69 @@
+// log10.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file log10.inl
+
+ Provides CORDIC for log10 function
+*/
+
+#ifndef INC_STD_LOG10_INL_
+#define INC_STD_LOG10_INL_
+
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+
+namespace libq {
+/*!
+ \brief Computes the decimal logarithm with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits the caller needs
+ \note The absolute error is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         typename op,
+         typename up>
+typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
+    log10(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using log_type =
+        typename libq::details::log_of<T, n, f, e, op, up>::promoted_type;
+    using precision = libq::details::precision_traits<bits, f>;
+    using work_type = libq::UQ<63u, 62u, 0, op, up>;
+
+    assert(("[std::log10] argument is negative", _val > Q(0)));
+    if (_val <= Q(0)) {
+        throw std::logic_error("[std::log10]: argument is negative");
+    }
+
+    // log10(x) = log2(x) * log10(2), the product is done in 128 bits
+    std::int64_t const result = libq::details::mulshift(
+        libq::details::binary_logarithm<precision::iterations / 2u + 1u,
+                                        op,
+                                        up>(
+            static_cast<std::uint64_t>(_val.value()),
+            static_cast<int>(Q::bits_for_fractional) + e),
+        static_cast<std::int64_t>(work_type::CONST_LOG102.value()),
+        62u);
+
+    return libq::details::logarithm_cast<log_type>(result);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
+typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
+    log10(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::log10<f>(_val);
+}
+}  // namespace std
+
+#endif  // INC_STD_LOG10_INL_
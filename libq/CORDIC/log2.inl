@@ -0,0 +1,168 @@
+// log2.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file log2.inl
+
+ Provides CORDIC for log2 function
+ \ref see C. Baumann, "A simple and fast look-up table method to compute the
+ exp(x) and ln(x) functions", 2004
+*/
+
+#ifndef INC_STD_LOG2_INL_
+#define INC_STD_LOG2_INL_
+
+#include <boost/integer/static_min_max.hpp>
+#include <boost/integer/static_log2.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the format of the logarithms of the fixed-point numbers.
+ \note The logarithm is less than the number of bits of the argument in
+ magnitude, so \f$\lfloor\log_2 \max(n, f)\rfloor + 1\f$ integer bits are
+ added to the format of the argument.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
+class log_of
+    : public type_promotion_base<
+        fixed_point<typename std::make_signed<T>::type, n, f, e, op, up>
+        , boost::static_unsigned_max<
+                      (f > 0) ? (boost::static_log2<f>::value) : 0,
+                      (n > 0) ? (boost::static_log2<n>::value) : 0>::value + 1u
+        , 0
+        , 0> {
+};
+
+
+/*!
+ \brief Computes the binary logarithm of the positive stored integer _x of
+ the format with _fraction_bits fractional bits.
+ \return the logarithm with 56 fractional bits
+ \details Multiplicative normalization like libq::log does, but the LUT is
+ \f$\log_2(1 + 2^{-i})\f$, so no constant multiplication is needed:
+ 1. The argument is normalized to \f$x \in [0.5, 1)\f$ with 62 fractional
+ bits by the position of its leading bit p, so
+ \f$\log_2(x \cdot 2^p) = \log_2 x + p\f$.
+ 2. Every step with \f$x (1 + 2^{-i}) \leq 1\f$ adds \f$x \gg i\f$ to x and
+ subtracts \f$\log_2(1 + 2^{-i})\f$ from the result.
+ 3. The residual \f$x > 1 - 2^{-m}\f$ after m steps gives
+ \f$\log_2 x = (x - 1) \log_2 e + O(2^{-2m})\f$.
+ All the steps are done in 64-bit integers, so they do not overflow for any
+ format.
+*/
+template<std::size_t steps, class op, class up>
+std::int64_t binary_logarithm(std::uint64_t const _x, int const _fraction_bits) {  // NOLINT
+    using work_type = libq::Q<63u, 62u, 0, op, up>;
+    using lut_type = libq::cordic::lut<steps, work_type>;
+
+    static lut_type const logs = lut_type::log2_one_plus();
+
+    // x from [0.5, 1) with 62 fractional bits
+    int const leading = libq::details::msb(_x);
+    std::int64_t const power = leading + 1 - _fraction_bits;
+    std::uint64_t x = (leading <= 61) ? _x << (61 - leading) :
+                                        _x >> (leading - 61);
+
+    std::int64_t result(0);
+
+#ifdef LOOP_UNROLLING
+    auto const iteration_body = [&](std::size_t i) {  // NOLINT
+#else
+    for (std::size_t i = 0u; i != steps; ++i) {
+#endif
+        std::uint64_t const candidate = x + (x >> (i + 1u));
+        if (candidate <= (std::uint64_t(1u) << 62)) {
+            x = candidate;
+            result -= static_cast<std::int64_t>(logs[i].value());
+        }
+    };  // NOLINT
+#ifdef LOOP_UNROLLING
+    libq::details::unroll(iteration_body,
+                          0u,
+                          libq::details::loop_size<steps - 1u>());
+#endif
+
+    // log2(x) = (x - 1) * log2(e) for the residual
+    result -= libq::details::mulshift(
+        static_cast<std::int64_t>((std::uint64_t(1u) << 62) - x),
+        static_cast<std::int64_t>(work_type::CONST_LOG2E.value()),
+        62u);
+
+    return power * (std::int64_t(1) << 56) + ((result + 32) >> 6);
+}
+
+
+/*!
+ \brief Rounds the logarithm with 56 fractional bits to the format R.
+*/
+template<typename R>
+R logarithm_cast(std::int64_t _value) {
+    int const shift = 56 - static_cast<int>(R::bits_for_fractional) -
+        R::scaling_factor_exponent;
+    if (shift > 0) {
+        _value = (_value + (std::int64_t(1) << (shift - 1))) >> shift;
+    } else {
+        _value *= std::int64_t(1) << (-shift);
+    }
+
+    return R::wrap(static_cast<typename R::storage_type>(_value));
+}
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+/*!
+ \brief Computes the binary logarithm with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits the caller needs
+ \details See libq::details::binary_logarithm.
+ \note The absolute error is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         typename op,
+         typename up>
+typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
+    log2(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using log_type =
+        typename libq::details::log_of<T, n, f, e, op, up>::promoted_type;
+    using precision = libq::details::precision_traits<bits, f>;
+
+    assert(("[std::log2] argument is negative", _val > Q(0)));
+    if (_val <= Q(0)) {
+        throw std::logic_error("[std::log2]: argument is negative");
+    }
+
+    std::int64_t const result =
+        libq::details::binary_logarithm<precision::iterations / 2u + 1u,
+                                        op,
+                                        up>(
+            static_cast<std::uint64_t>(_val.value()),
+            static_cast<int>(Q::bits_for_fractional) + e);
+
+    return libq::details::logarithm_cast<log_type>(result);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
+typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
+    log2(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::log2<f>(_val);
+}
+}  // namespace std
+
+#endif  // INC_STD_LOG2_INL_
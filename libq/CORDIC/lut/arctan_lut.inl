@@ -34,6 +34,27 @@ lut<n, Q> lut<n, Q>::circular() {
 
     return this_class(table);
 }
+
+
+/*!
+ \brief Combines the neighbouring angles of libq::cordic::lut::circular, so
+ the radix-4 step subtracts \f$\sigma_1 a_{2j} + \sigma_2 a_{2j+1}\f$ by the
+ single look-up.
+*/
+template<std::size_t n, typename Q>
+lut<n, Q> lut<n, Q>::circular_radix4() {
+    static_assert(n % 2u == 0u, "radix-4 table keeps the pairs of angles");
+
+    this_class const angles = this_class::circular();
+    base_class table;
+
+    for (std::size_t i = 0; i != n; i += 2u) {
+        table[i] = Q(angles[i] + angles[i + 1u]);
+        table[i + 1u] = Q(angles[i] - angles[i + 1u]);
+    }
+
+    return this_class(table);
+}
 }  // namespace cordic
 }  // namespace libq
 
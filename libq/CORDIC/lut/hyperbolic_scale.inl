@@ -35,6 +35,26 @@ double lut<n, Q>::hyperbolic_scale_with_repeated_iterations(std::size_t _n) {
 
     return scale;
 }
+
+
+template<std::size_t n, typename Q>
+double lut<n, Q>::hyperbolic_scale(std::size_t _shifts) {
+    double scale(1.0);
+
+    std::size_t repeated(4u);
+    for (std::size_t i = 1u; i <= _shifts; ++i) {
+        double const factor = std::sqrt(1.0 - std::pow(2.0, -2.0 * i));
+
+        scale *= factor;
+        if (i == repeated) {
+            scale *= factor;
+
+            repeated = 3u * repeated + 1u;
+        }
+    }
+
+    return scale;
+}
 }  // namespace cordic
 }  // namespace libq
 
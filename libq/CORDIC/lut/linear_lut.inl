@@ -0,0 +1,37 @@
+// linear_lut.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file linear_lut.inl
+
+ Implements look-up table for CORDIC in linear coordinates.
+ \ref See H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_CORDIC_LINEAR_LUT_INL_
+#define INC_LIBQ_CORDIC_LINEAR_LUT_INL_
+
+namespace libq {
+namespace cordic {
+
+/*!
+ \ref See page 5, equation 7, m = 0 (linear coordinate system).
+*/
+template<std::size_t n, typename Q>
+lut<n, Q> lut<n, Q>::linear() {
+    base_class table;
+
+    // shift sequence is just 0, 1, 2, 3, ..., i, ...
+    // see page 10, table 24.1, m = 0
+    for (std::size_t i = 0; i != n; ++i) {
+        table[i] = Q(std::pow(2.0, -static_cast<double>(i)));
+    }
+
+    return this_class(table);
+}
+}  // namespace cordic
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_LINEAR_LUT_INL_
@@ -0,0 +1,50 @@
+// log_lut.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file log_lut.inl
+
+ Implements the look-up table of the multiplicative normalization for exp
+ and log functions.
+
+ \ref See J.-M. Muller, "Elementary Functions: Algorithms and
+ Implementation", chapter 8.
+*/
+
+#ifndef INC_LIBQ_CORDIC_LOG_LUT_INL_
+#define INC_LIBQ_CORDIC_LOG_LUT_INL_
+
+#include <cmath>
+
+namespace libq {
+namespace cordic {
+
+template<std::size_t n, typename Q>
+lut<n, Q> lut<n, Q>::log_one_plus() {
+    base_class table;
+
+    for (std::size_t i = 0; i != n; ++i) {
+        table[i] = Q(std::log1p(std::ldexp(1.0, -static_cast<int>(i + 1u))));
+    }
+
+    return this_class(table);
+}
+
+
+template<std::size_t n, typename Q>
+lut<n, Q> lut<n, Q>::log2_one_plus() {
+    base_class table;
+
+    for (std::size_t i = 0; i != n; ++i) {
+        table[i] = Q(std::log1p(std::ldexp(1.0, -static_cast<int>(i + 1u))) /
+                     std::log(2.0));
+    }
+
+    return this_class(table);
+}
+}  // namespace cordic
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_LOG_LUT_INL_
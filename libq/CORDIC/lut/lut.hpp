@@ -49,6 +49,15 @@ class lut
     static this_class circular();
 
 
+    /*!
+     \brief Creates the LUT of the combined angles for the radix-4 CORDIC
+     rotations in circular coordinates: entries \f$2j\f$ and \f$2j + 1\f$ are
+     \f$\arctan 2^{-2j} \pm \arctan 2^{-(2j+1)}\f$.
+     \note n must be even.
+    */
+    static this_class circular_radix4();
+
+
     /*!
      \brief Creates the LUT for angles in case of CORDIC rotations are performed
      in hyperbolic coordinates.
@@ -57,6 +66,13 @@ class lut
     static this_class hyperbolic_wo_repeated_iterations();
 
 
+    /*!
+     \brief Creates the LUT of \f$2^{-i}\f$ for CORDIC rotations in linear
+     coordinates.
+    */
+    static this_class linear();
+
+
     /*!
      \brief Creates the LUT of \f$2^{2^{-i}}\f$ for n positions.
      \note This LUT is used for exp function.
@@ -71,6 +87,36 @@ class lut
     static this_class inv_pow2();
 
 
+    /*!
+     \brief Creates the LUT of \f$\ln(1 + 2^{-i})\f$ for i = 1, ..., n.
+     \note This LUT is used for exp and log functions.
+    */
+    static this_class log_one_plus();
+
+
+    /*!
+     \brief Creates the LUT of \f$\log_2(1 + 2^{-i})\f$ for i = 1, ..., n.
+     \note This LUT is used for exp2 and log2 functions.
+    */
+    static this_class log2_one_plus();
+
+
+    /*!
+     \brief Creates the LUT of \f$\frac1x\f$ for n equal intervals of
+     \f$x \in [0.5, 1)\f$.
+     \note This LUT gives seeds for reciprocal function.
+    */
+    static this_class reciprocal();
+
+
+    /*!
+     \brief Creates the LUT of \f$\frac1{\sqrt{x}}\f$ for n equal intervals of
+     \f$x \in [0.25, 1)\f$.
+     \note This LUT gives seeds for reciprocal square root function.
+    */
+    static this_class inv_sqrt();
+
+
     /*!
      \brief Computes the scale of n CORDIC-rotations in circular coordinates.
     */
@@ -89,15 +135,26 @@ class lut
      \note This uses repeated iterations for convergence.
     */
     static double hyperbolic_scale_with_repeated_iterations(std::size_t _n);
+
+
+    /*!
+     \brief Computes the scale of CORDIC-rotations in hyperbolic coordinates
+     for shifts 1, 2, ..., _shifts.
+     \note Shifts 4, 13, 40, ... are repeated for convergence.
+    */
+    static double hyperbolic_scale(std::size_t _shifts);
 };
 }  // namespace cordic
 }  // namespace libq
 
 #include "arctan_lut.inl"
 #include "arctanh_lut.inl"
+#include "linear_lut.inl"
 
 #include "pow2_lut.inl"
 #include "inv_pow2_lut.inl"
+#include "log_lut.inl"
+#include "reciprocal_lut.inl"
 
 #include "circular_scales.inl"
 #include "hyperbolic_scale.inl"
@@ -0,0 +1,52 @@
+// reciprocal_lut.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \brief Implements the look-up tables of seeds for Newton-Raphson iterations
+ that compute \f$\frac1x\f$ and \f$\frac1{\sqrt{x}}\f$.
+*/
+
+#ifndef INC_LIBQ_CORDIC_RECIPROCAL_LUT_INL_
+#define INC_LIBQ_CORDIC_RECIPROCAL_LUT_INL_
+
+namespace libq {
+namespace cordic {
+
+/*!
+ \note Values are taken at the middle points of intervals.
+*/
+template<std::size_t n, typename Q>
+lut<n, Q> lut<n, Q>::reciprocal() {
+    base_class table;
+
+    for (std::size_t i = 0; i != n; ++i) {
+        double const x = 0.5 + (static_cast<double>(i) + 0.5) / (2.0 * n);
+
+        table[i] = Q(1.0 / x);
+    }
+
+    return this_class(table);
+}
+
+
+/*!
+ \note Values are taken at the middle points of intervals.
+*/
+template<std::size_t n, typename Q>
+lut<n, Q> lut<n, Q>::inv_sqrt() {
+    base_class table;
+
+    for (std::size_t i = 0; i != n; ++i) {
+        double const x = 0.25 + 0.75 * (static_cast<double>(i) + 0.5) / n;
+
+        table[i] = Q(1.0 / std::sqrt(x));
+    }
+
+    return this_class(table);
+}
+}  // namespace cordic
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_RECIPROCAL_LUT_INL_
@@ -0,0 +1,185 @@
+// polar.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file polar.inl
+
+ Provides CORDIC in vectoring mode for the joint computation of the vector
+ magnitude and its angle
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_CORDIC_POLAR_INL_
+#define INC_LIBQ_CORDIC_POLAR_INL_
+
+#include <boost/integer/static_min_max.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the format of the angles of the fixed-point vectors.
+*/
+template<typename T>
+class atan2_of {
+ public:
+    using promoted_type = T;
+};
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class atan2_of<libq::fixed_point<T, n, f, e, op, up> >
+    : private libq::fixed_point<typename std::make_signed<T>::type, 0, f, e, op, up>,  // NOLINT
+      public type_promotion_base<
+          libq::fixed_point<typename std::make_signed<T>::type, 0, f, e, op, up>,  // NOLINT
+          2u,
+          0,
+          0> {
+};
+
+
+/*!
+ \brief Gets the format of the magnitudes of the fixed-point vectors.
+*/
+template<typename T>
+class hypot_of {
+ public:
+    using promoted_type = T;
+};
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class hypot_of<libq::fixed_point<T, n, f, e, op, up> >
+    : public type_promotion_base<libq::fixed_point<T, n, f, e, op, up>,
+                                 1u,
+                                 0,
+                                 0> {
+};
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+/*!
+ \brief Computes both the magnitude and the angle of vector (x, y) by the
+ single CORDIC pass in vectoring mode.
+ \tparam bits number of accurate fractional bits of the angle
+ \return the pair of \f$\sqrt{x^2 + y^2}\f$ and \f$atan2(y, x)\f$
+ \details
+ 1. The vector is scaled by \f$2^s\f$ to make
+ \f$\max(|x|, |y|) \in [0.5, 1)\f$: the angle does not depend on the
+ scale and the magnitude is scaled back by the rounded shift. The scaled
+ vector keeps \f$n + bits\f$ bits and the guard bits, so no bit of the
+ coordinates is lost and the absolute precision is the same for short and
+ long vectors.
+ 2. Vectors of the left half-plane are rotated by \f$\pm\pi\f$ to the
+ convergence interval \f$[-\frac{\pi}{2}, \frac{\pi}{2}]\f$.
+ 3. Rotations drive y to zero, the sum of rotation angles gives
+ \f$atan2(y, x)\f$ and x converges to the magnitude multiplied by the
+ CORDIC gain.
+ \note The absolute errors of the angle and of the magnitude are bounded by
+ libq::details::precision_traits<bits, f>::error_bound() plus one ulp of
+ the result.
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+std::pair<
+    typename libq::details::hypot_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type,  // NOLINT
+    typename libq::details::atan2_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type>  // NOLINT
+    polar(libq::fixed_point<T, n, f, e, op, up> _x,
+          libq::fixed_point<T, n, f, e, op, up> _y) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using hypot_type = typename libq::details::hypot_of<Q>::promoted_type;
+    using atan2_type = typename libq::details::atan2_of<Q>::promoted_type;
+    using precision = libq::details::precision_traits<bits, f>;
+
+    // the normalized vector keeps all the significant bits of the
+    // coordinates and the guard bits, 3 bits for integer part keep pi and
+    // the CORDIC gain
+    enum: std::size_t {
+        work_fractional = boost::static_unsigned_min<
+            n + bits + precision::guard_bits,
+            60u>::value
+    };
+    using work_type = libq::Q<work_fractional + 3u,
+                              work_fractional,
+                              e,
+                              op,
+                              up>;
+    using storage_type = typename work_type::storage_type;
+    using engine_type = libq::cordic::engine<libq::cordic::vectoring,
+                                             libq::cordic::circular,
+                                             work_type,
+                                             precision::iterations>;
+
+    // 1/gain < 1 is scaled by 2^64
+    static std::uint64_t const inv_gain = static_cast<std::uint64_t>(
+        std::ldexp(1.0 / engine_type::gain(), 64));
+
+    std::int64_t const x0 = static_cast<std::int64_t>(_x.value());
+    std::int64_t const y0 = static_cast<std::int64_t>(_y.value());
+    std::uint64_t const m = std::max(
+        static_cast<std::uint64_t>((x0 < 0) ? -x0 : x0),
+        static_cast<std::uint64_t>((y0 < 0) ? -y0 : y0));
+    if (m == 0u) {
+        return std::make_pair(hypot_type(0), atan2_type(0));
+    }
+
+    // scales the vector to [0.5, 1.0)
+    int const shift = static_cast<int>(work_fractional) - 1 -
+        libq::details::msb(m);
+
+    work_type x, y, z(0);
+    if (shift >= 0) {
+        x = work_type::wrap(static_cast<storage_type>(x0 << shift));
+        y = work_type::wrap(static_cast<storage_type>(y0 << shift));
+    } else {
+        x = work_type::wrap(static_cast<storage_type>(x0 >> (-shift)));
+        y = work_type::wrap(static_cast<storage_type>(y0 >> (-shift)));
+    }
+
+    // rotates the left half-plane by pi
+    if (x.value() < 0) {
+        z = (y.value() >= 0) ? work_type::CONST_PI : -work_type::CONST_PI;
+        x = -x;
+        y = -y;
+    }
+
+    // vectoring mode: see page 10, table 24.2
+    typename engine_type::state_type const state = engine_type::apply(x, y, z);
+    x = std::get<0>(state);
+    z = std::get<2>(state);
+
+    // removes the CORDIC gain and the scale with rounding: x is positive
+    // here
+    std::int64_t const magnitude = static_cast<std::int64_t>(
+        libq::details::mulhi(static_cast<std::uint64_t>(x.value()), inv_gain));
+    hypot_type const r = hypot_type::wrap(
+        static_cast<typename hypot_type::storage_type>(
+            (shift > 0) ?
+                ((magnitude + (std::int64_t(1) << (shift - 1))) >> shift) :
+                (magnitude << (-shift))));
+
+    // rounds the angle to the format of the result
+    int const angle_shift = static_cast<int>(work_fractional) -
+        static_cast<int>(atan2_type::bits_for_fractional);
+    std::int64_t const angle = static_cast<std::int64_t>(z.value());
+    atan2_type const phi = atan2_type::wrap(
+        static_cast<typename atan2_type::storage_type>(
+            (angle_shift > 0) ?
+                ((angle + (std::int64_t(1) << (angle_shift - 1))) >> angle_shift) :  // NOLINT
+                (angle << (-angle_shift))));
+
+    return std::make_pair(r, phi);
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_POLAR_INL_
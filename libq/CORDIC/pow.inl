@@ -0,0 +1,237 @@
+// pow.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file pow.inl
+
+ Provides CORDIC for pow function as \f$x^y = 2^{y \log_2 x}\f$
+*/
+
+#ifndef INC_LIBQ_DETAILS_POW_INL_
+#define INC_LIBQ_DETAILS_POW_INL_
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the format of the powers of the fixed-point numbers.
+ \note The power keeps the fractional bits of the base and takes all the
+ rest of the widest signed type for the integer part.
+*/
+template<typename T>
+class pow_of {
+ public:
+    using promoted_type = T;
+};
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class pow_of<libq::fixed_point<T, n, f, e, op, up> > {
+ public:
+    using promoted_type = libq::fixed_point<
+                                std::intmax_t,
+                                std::numeric_limits<std::intmax_t>::digits - f,
+                                f,
+                                e,
+                                op,
+                                up>;
+};
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+template<std::size_t bits,
+         typename T1,
+         typename T2,
+         std::size_t n1,
+         std::size_t n2,
+         std::size_t f1,
+         std::size_t f2,
+         int e1,
+         int e2,
+         class op,
+         class up>
+typename libq::details::pow_of<libq::fixed_point<T1, n1, f1, e1, op, up> >::promoted_type  // NOLINT
+    pow(libq::fixed_point<T1, n1, f1, e1, op, up> _x,
+        libq::fixed_point<T2, n2, f2, e2, op, up> _y);
+
+
+/*!
+ \brief Computes the integer power by squaring.
+ \details The negative exponent is processed as \f$2^{n \log_2 x}\f$. The
+ overflow of any product is raised by the overflow policy and the result is
+ saturated then, like the one of libq::details::power_of_two.
+ \note No CORDIC iterations are needed for the non-negative exponent, so the
+ template parameter bits is used for the negative exponent only.
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+typename libq::details::pow_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    pow(libq::fixed_point<T, n, f, e, op, up> _x, int _n) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using pow_type = typename libq::details::pow_of<Q>::promoted_type;
+    using integer_type = libq::fixed_point<std::intmax_t,
+                                           std::numeric_limits<std::intmax_t>::digits,  // NOLINT
+                                           0,
+                                           0,
+                                           op,
+                                           up>;
+
+    if (_n < 0) {
+        return libq::pow<bits>(_x, integer_type::wrap(_n));
+    }
+
+    std::size_t const fraction_bits = f + e;
+    std::int64_t result = std::int64_t(1) << fraction_bits;
+    std::int64_t base = static_cast<std::int64_t>(_x.value());
+
+    // the square overflows for |x| > 1 only, and the power does then as well
+    bool overflow(false);
+    for (unsigned k = static_cast<unsigned>(_n); k != 0u; k >>= 1u) {
+        if (k & 1u) {
+            result = libq::details::mulshift(result,
+                                             base,
+                                             fraction_bits,
+                                             overflow);
+        }
+        if (k > 1u) {
+            base = libq::details::mulshift(base, base, fraction_bits, overflow);
+        }
+    }
+
+    std::int64_t const largest =
+        static_cast<std::int64_t>(libq::details::largest_stored<pow_type>());
+    if (overflow || result > largest || result < -largest) {
+        pow_type::overflow_policy::raise_event();
+
+        bool const negative = (_x < Q(0)) && (_n & 1);
+        result = negative ? -largest : largest;
+    }
+
+    return pow_type::wrap(result);
+}
+
+
+/*!
+ \brief Computes \f$x^y\f$ with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits of \f$\log_2 x\f$ and
+ \f$2^{y \log_2 x}\f$
+ \details The non-negative integer exponent goes to the fast path by
+ squaring. Otherwise \f$x^y = 2^{y \log_2 |x|}\f$, where the product is
+ computed in 128 bits, so it does not overflow for wide formats. The negative
+ base is allowed for the integer exponent only.
+*/
+template<std::size_t bits,
+         typename T1,
+         typename T2,
+         std::size_t n1,
+         std::size_t n2,
+         std::size_t f1,
+         std::size_t f2,
+         int e1,
+         int e2,
+         class op,
+         class up>
+typename libq::details::pow_of<libq::fixed_point<T1, n1, f1, e1, op, up> >::promoted_type  // NOLINT
+    pow(libq::fixed_point<T1, n1, f1, e1, op, up> _x,
+        libq::fixed_point<T2, n2, f2, e2, op, up> _y) {
+    using Q1 = libq::fixed_point<T1, n1, f1, e1, op, up>;
+    using pow_type = typename libq::details::pow_of<Q1>::promoted_type;
+    using precision = libq::details::precision_traits<bits, f1>;
+
+    enum: std::size_t {
+        steps = precision::iterations / 2u + 1u
+    };
+
+    std::size_t const exponent_fraction = f2 + e2;
+    std::int64_t const y = static_cast<std::int64_t>(_y.value());
+    bool const is_integer =
+        !(y & ((std::int64_t(1) << exponent_fraction) - 1));
+    std::int64_t const integer = y >> exponent_fraction;
+
+    if (is_integer && integer >= 0 &&
+        integer <= std::numeric_limits<int>::max()) {
+        return libq::pow<bits>(_x, static_cast<int>(integer));
+    }
+
+    if (_x == Q1(0)) {
+        assert(("[std::pow] zero base with negative exponent", y >= 0));
+        if (y < 0) {
+            throw std::logic_error("[std::pow]: zero base with negative exponent");  // NOLINT
+        }
+
+        return pow_type(0);
+    }
+
+    bool const negative = (_x < Q1(0));
+    assert(("[std::pow] negative base with non-integer exponent",
+            !negative || is_integer));
+    if (negative && !is_integer) {
+        throw std::logic_error("[std::pow]: negative base with non-integer exponent");  // NOLINT
+    }
+
+    std::int64_t const x = static_cast<std::int64_t>(_x.value());
+    std::int64_t const l = libq::details::binary_logarithm<steps, op, up>(
+        negative ? std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+                   static_cast<std::uint64_t>(x),
+        static_cast<int>(Q1::bits_for_fractional) + e1);
+
+    // y * log2|x| with 56 fractional bits: the exponents beyond 96 in
+    // magnitude overflow or underflow any 64-bit format, so the product is
+    // estimated first to keep it in 64 bits
+    double const estimate = static_cast<double>(y) * static_cast<double>(l) /
+        std::ldexp(1.0, 56 + static_cast<int>(exponent_fraction));
+
+    pow_type r(0);
+    if (estimate >= 96.0) {
+        r = libq::details::power_of_two<steps, pow_type>(96, 0);
+    } else if (estimate > -96.0) {
+        std::int64_t const p =
+            libq::details::mulshift(y, l, exponent_fraction);
+
+        r = libq::details::power_of_two<steps, pow_type>(
+            p >> 56,
+            (p & ((std::int64_t(1) << 56) - 1)) << 6);
+    }
+
+    return (negative && (integer & 1)) ? pow_type(-r) : r;
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::pow_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    pow(libq::fixed_point<T, n, f, e, op, up> _x, int _n) {
+    return libq::pow<f>(_x, _n);
+}
+
+template<typename T1,
+         typename T2,
+         std::size_t n1,
+         std::size_t n2,
+         std::size_t f1,
+         std::size_t f2,
+         int e1,
+         int e2,
+         class op,
+         class up>
+typename libq::details::pow_of<libq::fixed_point<T1, n1, f1, e1, op, up> >::promoted_type  // NOLINT
+    pow(libq::fixed_point<T1, n1, f1, e1, op, up> _x,
+        libq::fixed_point<T2, n2, f2, e2, op, up> _y) {
+    return libq::pow<f1>(_x, _y);
+}
+}  // namespace std
+
+#endif  // INC_LIBQ_DETAILS_POW_INL_
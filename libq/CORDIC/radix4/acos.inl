@@ -0,0 +1,56 @@
+// acos.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file acos.inl
+
+ Provides the radix-4 CORDIC engine for acos function
+*/
+
+#ifndef INC_LIBQ_CORDIC_RADIX4_ACOS_INL_
+#define INC_LIBQ_CORDIC_RADIX4_ACOS_INL_
+
+namespace libq {
+namespace details {
+/*!
+ \details \f$\arccos x = \frac{\pi}{2} - \arcsin x\f$, where the arcsine is
+ computed by libq::details::asin_double_rotation_radix4.
+*/
+template<>
+class acos_impl<libq::engine::cordic_radix4> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::acos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using Q = libq::fixed_point<T, n, f, e, op, up>;
+        using result_type = typename libq::details::acos_of<Q>::promoted_type;
+        using precision = libq::details::precision_traits<f, f>;
+        using work_type = typename libq::details::acos_of<
+            libq::fixed_point<T, n, precision::bits_for_fractional, e, op, up> >::promoted_type;  // NOLINT
+
+        assert(("[std::acos] argument is not from [-1.0, 1.0]",
+                std::fabs(_val) <= Q(1.0)));
+        if (std::fabs(_val) > Q(1.0)) {
+            throw std::logic_error("[std::acos] argument is not from [-1.0, 1.0]");  // NOLINT
+        }
+        if (_val == Q(1.0)) {
+            return result_type::wrap(0);
+        } else if (_val == Q(-1.0)) {
+            return result_type::CONST_PI;
+        } else if (_val == Q::wrap(0)) {
+            return result_type::CONST_PI_2;
+        }
+
+        work_type const z =
+            libq::details::asin_double_rotation_radix4<precision::iterations>(  // NOLINT
+                work_type(_val));
+
+        return result_type(work_type::CONST_PI_2 - z);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_RADIX4_ACOS_INL_
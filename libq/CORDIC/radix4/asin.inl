@@ -0,0 +1,130 @@
+// asin.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file asin.inl
+
+ Provides the radix-4 CORDIC engine for asin function
+*/
+
+#ifndef INC_LIBQ_CORDIC_RADIX4_ASIN_INL_
+#define INC_LIBQ_CORDIC_RADIX4_ASIN_INL_
+
+#include <limits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the arcsine by the radix-4 double-rotation CORDIC.
+ \param _t argument from \f$[-1, 1]\f$
+ \details The step \f$j\f$ merges the iterations \f$i = 2j\f$ and \f$i + 1\f$
+ of libq::details::asin_double_rotation: the second direction compares y
+ after the first double rotation with the target, both double rotations are
+ the shifts and the adds, and the angle is accumulated by one look-up of
+ \f$\arctan 2^{-i} \pm \arctan 2^{-(i+1)}\f$. The gains are compensated by
+ the shift and the add of the target as in the radix-2 loop, so no
+ multiplication is done.
+ \note work_type needs 2 bits for the integer part, see
+ libq::details::asin_double_rotation.
+*/
+template<std::size_t iterations, typename work_type>
+work_type asin_double_rotation_radix4(work_type const _t) {
+    using steps = libq::details::radix4_steps<iterations>;
+    using lut_type = libq::cordic::lut<steps::iterations_value, work_type>;
+    using storage_type = typename work_type::storage_type;
+    enum: std::size_t {
+        digits = std::numeric_limits<storage_type>::digits
+    };
+
+    static lut_type const pairs = lut_type::circular_radix4();
+
+    storage_type x(work_type(1.0).value()), y(0), z(0), t(_t.value());
+
+#ifdef LOOP_UNROLLING
+    auto const iteration_body = [&](std::size_t j) {  // NOLINT
+#else
+    for (std::size_t j = 0u; j != steps::value; ++j) {
+#endif
+        std::size_t const i = 2u * j;
+
+        storage_type const sign1 = ((t >= y) == (x >= 0)) ? 0 : -1;
+        storage_type const x1 = x - libq::details::negate_if(
+            libq::details::shift_right(y, i), sign1);
+        storage_type const y1 = y + libq::details::negate_if(
+            libq::details::shift_right(x, i), sign1);
+        storage_type const x2 = x1 - libq::details::negate_if(
+            libq::details::shift_right(y1, i), sign1);
+        storage_type const y2 = y1 + libq::details::negate_if(
+            libq::details::shift_right(x1, i), sign1);
+        if (2u * i < digits) {
+            t += libq::details::shift_right(t, 2u * i);
+        }
+
+        storage_type const sign2 = ((t >= y2) == (x2 >= 0)) ? 0 : -1;
+        storage_type const sign12 = sign1 ^ sign2;
+        storage_type const x3 = x2 - libq::details::negate_if(
+            libq::details::shift_right(y2, i + 1u), sign2);
+        storage_type const y3 = y2 + libq::details::negate_if(
+            libq::details::shift_right(x2, i + 1u), sign2);
+        x = x3 - libq::details::negate_if(
+            libq::details::shift_right(y3, i + 1u), sign2);
+        y = y3 + libq::details::negate_if(
+            libq::details::shift_right(x3, i + 1u), sign2);
+        if (2u * (i + 1u) < digits) {
+            t += libq::details::shift_right(t, 2u * (i + 1u));
+        }
+
+        storage_type const angle = static_cast<storage_type>(
+            2 * pairs[(sign12 == 0) ? i : i + 1u].value());
+        z += libq::details::negate_if(angle, sign1);
+    };  // NOLINT
+#ifdef LOOP_UNROLLING
+    libq::details::unroll(iteration_body,
+                          0u,
+                          libq::details::loop_size<steps::value - 1u>());
+#endif
+
+    return work_type::wrap(z);
+}
+
+
+/*!
+ \details See libq::details::asin_double_rotation_radix4.
+*/
+template<>
+class asin_impl<libq::engine::cordic_radix4> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::asin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using Q = libq::fixed_point<T, n, f, e, op, up>;
+        using result_type = typename libq::details::asin_of<Q>::promoted_type;
+        using precision = libq::details::precision_traits<f, f>;
+        using work_type = typename libq::details::asin_of<
+            libq::fixed_point<T, n, precision::bits_for_fractional, e, op, up> >::promoted_type;  // NOLINT
+
+        assert(("[std::asin] argument is not from [-1.0, 1.0]",
+                std::fabs(_val) <= Q(1.0f)));
+        if (std::fabs(_val) > Q(1.0f)) {
+            throw std::logic_error("[std::asin] argument is out of range");
+        }
+
+        if (_val == Q(1.0f)) {
+            return result_type::CONST_PI_2;
+        } else if (_val == Q(-1.0f)) {
+            return -(result_type::CONST_PI_2);
+        } else if (_val == Q(0.0)) {
+            return result_type::wrap(0);
+        }
+
+        return result_type(
+            libq::details::asin_double_rotation_radix4<precision::iterations>(  // NOLINT
+                work_type(_val)));
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_RADIX4_ASIN_INL_
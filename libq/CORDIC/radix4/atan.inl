@@ -0,0 +1,96 @@
+// atan.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file atan.inl
+
+ Provides the radix-4 CORDIC engine for atan function
+*/
+
+#ifndef INC_LIBQ_CORDIC_RADIX4_ATAN_INL_
+#define INC_LIBQ_CORDIC_RADIX4_ATAN_INL_
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes \f$\arctan\frac{y}{x}\f$ by the radix-4 CORDIC vectoring.
+ \param _x is positive, so it stays positive during the vectoring
+ \details The step \f$j\f$ merges the iterations \f$i = 2j\f$ and \f$i + 1\f$.
+ The second direction \f$\sigma_2\f$ is the sign of \f$y'\f$ after the first
+ rotation, the rest of the second rotation is expanded like in
+ libq::details::sincos_radix4.
+*/
+template<std::size_t iterations, typename work_type>
+work_type vectoring_radix4(work_type const _x, work_type const _y) {
+    using steps = libq::details::radix4_steps<iterations>;
+    using lut_type = libq::cordic::lut<steps::iterations_value, work_type>;
+    using storage_type = typename work_type::storage_type;
+
+    static lut_type const pairs = lut_type::circular_radix4();
+
+    storage_type x(_x.value()), y(_y.value()), z(0);
+
+#ifdef LOOP_UNROLLING
+    auto const iteration_body = [&](std::size_t j) {  // NOLINT
+#else
+    for (std::size_t j = 0u; j != steps::value; ++j) {
+#endif
+        std::size_t const i = 2u * j;
+
+        storage_type const sign1 = (y > 0) ? 0 : -1;
+        storage_type const x1 = x + libq::details::negate_if(
+            libq::details::shift_right(y, i), sign1);
+        storage_type const y1 = y - libq::details::negate_if(
+            libq::details::shift_right(x, i), sign1);
+
+        storage_type const sign2 = (y1 > 0) ? 0 : -1;
+        storage_type const sign12 = sign1 ^ sign2;
+        storage_type const x2 = x1 +
+            libq::details::negate_if(
+                libq::details::shift_right(y, i + 1u), sign2) -
+            libq::details::negate_if(
+                libq::details::shift_right(x, 2u * i + 1u), sign12);
+        storage_type const y2 = y1 -
+            libq::details::negate_if(
+                libq::details::shift_right(x, i + 1u), sign2) -
+            libq::details::negate_if(
+                libq::details::shift_right(y, 2u * i + 1u), sign12);
+
+        x = x2; y = y2;
+        storage_type const angle =
+            pairs[(sign12 == 0) ? i : i + 1u].value();
+        z += libq::details::negate_if(angle, sign1);
+    };  // NOLINT
+#ifdef LOOP_UNROLLING
+    libq::details::unroll(iteration_body,
+                          0u,
+                          libq::details::loop_size<steps::value - 1u>());
+#endif
+
+    return work_type::wrap(z);
+}
+
+
+template<>
+class atan_impl<libq::engine::cordic_radix4> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using result_type =
+            typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using precision = libq::details::precision_traits<f, f>;
+        using work_type = typename libq::details::atan_of<
+            libq::fixed_point<T, n, precision::bits_for_fractional, e, op, up> >::promoted_type;  // NOLINT
+
+        return result_type(
+            libq::details::vectoring_radix4<precision::iterations>(
+                work_type(1.0), work_type(_val)));
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_RADIX4_ATAN_INL_
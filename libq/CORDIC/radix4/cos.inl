@@ -0,0 +1,53 @@
+// cos.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file cos.inl
+
+ Provides the radix-4 CORDIC engine for cos function
+*/
+
+#ifndef INC_LIBQ_CORDIC_RADIX4_COS_INL_
+#define INC_LIBQ_CORDIC_RADIX4_COS_INL_
+
+namespace libq {
+namespace details {
+template<>
+class cos_impl<libq::engine::cordic_radix4> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using cos_type =
+            typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using precision = libq::details::precision_traits<f, f>;
+        using work_type =
+            libq::Q<precision::bits_for_fractional + 3u,
+                    precision::bits_for_fractional, e, op, up>;
+
+        // cos(x) is one of cos(r), -sin(r), -cos(r), sin(r)
+        // depending on k mod 4, see libq::cos
+        work_type arg(0);
+        int const quadrant = libq::details::reduce_angle(_val, arg);
+
+        work_type y, x;
+        libq::details::sincos_radix4<precision::iterations>(arg, y, x);
+
+        switch (quadrant) {
+        case 0:
+            return cos_type(x);
+        case 1:
+            return cos_type(-y);
+        case 2:
+            return cos_type(-x);
+        default:
+            return cos_type(y);
+        }
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_RADIX4_COS_INL_
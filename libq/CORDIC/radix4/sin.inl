@@ -0,0 +1,53 @@
+// sin.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sin.inl
+
+ Provides the radix-4 CORDIC engine for sin function
+*/
+
+#ifndef INC_LIBQ_CORDIC_RADIX4_SIN_INL_
+#define INC_LIBQ_CORDIC_RADIX4_SIN_INL_
+
+namespace libq {
+namespace details {
+template<>
+class sin_impl<libq::engine::cordic_radix4> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using sin_type =
+            typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using precision = libq::details::precision_traits<f, f>;
+        using work_type =
+            libq::Q<precision::bits_for_fractional + 3u,
+                    precision::bits_for_fractional, e, op, up>;
+
+        // sin(x) is one of sin(r), cos(r), -sin(r), -cos(r)
+        // depending on k mod 4, see libq::sin
+        work_type arg(0);
+        int const quadrant = libq::details::reduce_angle(_val, arg);
+
+        work_type y, x;
+        libq::details::sincos_radix4<precision::iterations>(arg, y, x);
+
+        switch (quadrant) {
+        case 0:
+            return sin_type(y);
+        case 1:
+            return sin_type(x);
+        case 2:
+            return sin_type(-y);
+        default:
+            return sin_type(-x);
+        }
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_RADIX4_SIN_INL_
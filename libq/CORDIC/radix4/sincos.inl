@@ -0,0 +1,133 @@
+// sincos.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sincos.inl
+
+ Provides the radix-4 CORDIC rotation shared by sin and cos functions
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_CORDIC_RADIX4_SINCOS_INL_
+#define INC_LIBQ_CORDIC_RADIX4_SINCOS_INL_
+
+#include <limits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the number of radix-4 steps replacing the given number of CORDIC
+ iterations: every step resolves two bits.
+*/
+template<std::size_t iterations>
+class radix4_steps {
+ public:
+    enum: std::size_t {
+        value = (iterations + 1u) / 2u,
+        iterations_value = 2u * value
+    };
+};
+
+
+/*!
+ \brief Shifts the stored integer to the right, the shift may exceed its
+ width.
+*/
+template<typename T>
+T shift_right(T const _x, std::size_t const _shift) {
+    if (_shift < static_cast<std::size_t>(std::numeric_limits<T>::digits)) {
+        return static_cast<T>(_x >> _shift);
+    }
+
+    return (_x < 0) ? T(-1) : T(0);
+}
+
+
+/*!
+ \brief Negates the stored integer if the mask is -1, keeps it if the mask
+ is 0. The branch-free form suits the random directions of CORDIC.
+*/
+template<typename T>
+T negate_if(T const _x, T const _mask) {
+    return static_cast<T>((_x ^ _mask) - _mask);
+}
+
+
+/*!
+ \brief Computes both sine and cosine of the reduced angle by the radix-4
+ CORDIC rotation.
+ \param _angle is from the convergence interval
+ \f$[-\frac{\pi}{2}, \frac{\pi}{2}]\f$
+ \details The step \f$j\f$ merges the iterations \f$i = 2j\f$ and \f$i + 1\f$
+ of libq::details::sincos. Both directions are found from z at once:
+ \f$\sigma_1 = sign(z)\f$ and \f$\sigma_2 = sign(z - \sigma_1 a_i)\f$, so the
+ digit \f$2\sigma_1 + \sigma_2 \in \{-3, -1, 1, 3\}\f$ is the radix-4 one.
+ The second rotation is expanded:
+ \f[
+    x'' = x' - \sigma_2 2^{-(i+1)} y - \sigma_1 \sigma_2 2^{-(2i+1)} x
+ \f]
+ and similar for y, so its shifts do not wait for the first rotation. The
+ gain is the one of 2j iterations of the radix-2 CORDIC.
+*/
+template<std::size_t iterations, typename work_type>
+void sincos_radix4(work_type const _angle, work_type& _sin, work_type& _cos) {
+    using steps = libq::details::radix4_steps<iterations>;
+    using lut_type = libq::cordic::lut<steps::iterations_value, work_type>;
+    using storage_type = typename work_type::storage_type;
+
+    static lut_type const angles = lut_type::circular();
+    static lut_type const pairs = lut_type::circular_radix4();
+    static work_type const norm_factor(
+        1.0 / lut_type::circular_scale(steps::iterations_value));
+
+    storage_type x(norm_factor.value()), y(0), z(_angle.value());
+
+#ifdef LOOP_UNROLLING
+    auto const iteration_body = [&](std::size_t j) {  // NOLINT
+#else
+    for (std::size_t j = 0; j != steps::value; ++j) {
+#endif
+        std::size_t const i = 2u * j;
+        storage_type const a = angles[i].value();
+
+        // both directions are found at once: sigma_2 = sign(z - sigma_1 a_i)
+        storage_type const sign1 = (z > 0) ? 0 : -1;
+        storage_type const sign2 =
+            (z > libq::details::negate_if(a, sign1)) ? 0 : -1;
+        storage_type const sign12 = sign1 ^ sign2;
+
+        storage_type const x1 = x - libq::details::negate_if(
+            libq::details::shift_right(y, i), sign1);
+        storage_type const y1 = y + libq::details::negate_if(
+            libq::details::shift_right(x, i), sign1);
+        storage_type const x2 = x1 -
+            libq::details::negate_if(
+                libq::details::shift_right(y, i + 1u), sign2) -
+            libq::details::negate_if(
+                libq::details::shift_right(x, 2u * i + 1u), sign12);
+        storage_type const y2 = y1 +
+            libq::details::negate_if(
+                libq::details::shift_right(x, i + 1u), sign2) -
+            libq::details::negate_if(
+                libq::details::shift_right(y, 2u * i + 1u), sign12);
+
+        x = x2; y = y2;
+        storage_type const angle =
+            pairs[(sign12 == 0) ? i : i + 1u].value();
+        z -= libq::details::negate_if(angle, sign1);
+    };  // NOLINT
+#ifdef LOOP_UNROLLING
+    libq::details::unroll(iteration_body,
+                          0u,
+                          libq::details::loop_size<steps::value - 1u>());
+#endif
+
+    _sin = work_type::wrap(y);
+    _cos = work_type::wrap(x);
+}
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_RADIX4_SINCOS_INL_
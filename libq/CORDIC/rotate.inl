@@ -0,0 +1,270 @@
+// rotate.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file rotate.inl
+
+ Provides CORDIC in rotation mode for the rotation of vectors by the given
+ angle
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_CORDIC_ROTATE_INL_
+#define INC_LIBQ_CORDIC_ROTATE_INL_
+
+#include <boost/integer/static_min_max.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the format of the rotated coordinates of the fixed-point
+ vectors.
+*/
+template<typename T>
+class rotate_of {
+ public:
+    using promoted_type = T;
+};
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class rotate_of<libq::fixed_point<T, n, f, e, op, up> >
+    : public type_promotion_base<
+          libq::fixed_point<typename std::make_signed<T>::type, n, f, e, op, up>,  // NOLINT
+          1u,
+          0,
+          0> {
+};
+
+
+/*!
+ \brief Rotates vectors of the fixed-point type Q by the angle that is
+ resolved just once.
+ \tparam bits number of accurate fractional bits, see libq::rotate
+ \details The constructor reduces the angle to
+ \f$r \in [-\frac{\pi}{4}, \frac{\pi}{4}]\f$ and the quadrant, and keeps the
+ directions of CORDIC rotation by r: they depend on the angle only. So every
+ vector costs the quadrant swap, the CORDIC pass of shifts and adds and the
+ compensation of the gain.
+
+ The vector is scaled to \f$[0.5, 1)\f$, so the absolute error \f$2^{-bits}\f$
+ of the vector of length up to \f$2^n\f$ needs \f$n + bits\f$ accurate bits
+ of the scaled one: the steps and the guard bits are counted for them.
+*/
+template<std::size_t bits, typename Q>
+class rotator {
+    // the work type of 60 fractional bits keeps 4 guard bits at least
+    enum: std::size_t {
+        accurate_bits = boost::static_unsigned_min<
+            Q::bits_for_integral + bits,
+            56u>::value
+    };
+    using precision = libq::details::precision_traits<accurate_bits, 60u>;
+
+    // the scaled vector keeps all the significant bits of the coordinates
+    // and the guard bits, 3 bits for integer part keep the vector of length
+    // sqrt(2) multiplied by the CORDIC gain
+    using work_type = libq::Q<precision::bits_for_fractional + 3u,
+                              precision::bits_for_fractional,
+                              Q::scaling_factor_exponent,
+                              typename Q::overflow_policy,
+                              typename Q::underflow_policy>;
+    using storage_type = typename work_type::storage_type;
+    using engine_type = libq::cordic::engine<libq::cordic::rotation,
+                                             libq::cordic::circular,
+                                             work_type,
+                                             precision::iterations>;
+
+ public:
+    using result_type = typename libq::details::rotate_of<Q>::promoted_type;
+
+    template<typename A>
+    explicit rotator(A const _angle)
+        : m_quadrant(0),
+          m_directions() {
+        work_type r(0);
+        m_quadrant = libq::details::reduce_angle(_angle, r);
+        m_directions = engine_type::directions(r);
+    }
+
+    std::pair<result_type, result_type> operator()(Q const _x,
+                                                   Q const _y) const {
+        // 1/gain < 1 is scaled by 2^64
+        static std::uint64_t const inv_gain = static_cast<std::uint64_t>(
+            std::ldexp(1.0 / engine_type::gain(), 64));
+
+        // rotation by k * pi/2 just swaps the coordinates
+        std::int64_t x0 = static_cast<std::int64_t>(_x.value());
+        std::int64_t y0 = static_cast<std::int64_t>(_y.value());
+        switch (m_quadrant) {
+        case 1:
+            std::swap(x0, y0);
+            x0 = -x0;
+            break;
+        case 2:
+            x0 = -x0;
+            y0 = -y0;
+            break;
+        case 3:
+            std::swap(x0, y0);
+            y0 = -y0;
+            break;
+        default:
+            break;
+        }
+
+        std::uint64_t const m = std::max(
+            static_cast<std::uint64_t>((x0 < 0) ? -x0 : x0),
+            static_cast<std::uint64_t>((y0 < 0) ? -y0 : y0));
+        if (m == 0u) {
+            return std::make_pair(result_type(0), result_type(0));
+        }
+
+        // scales the vector to [0.5, 1.0) like libq::polar does
+        int const shift = static_cast<int>(precision::bits_for_fractional) -
+            1 - libq::details::msb(m);
+        auto const normalize = [shift](std::int64_t const _c) {
+            return work_type::wrap(static_cast<storage_type>(
+                (shift >= 0) ? (_c << shift) : (_c >> (-shift))));
+        };
+
+        std::pair<work_type, work_type> const v =
+            engine_type::apply(normalize(x0), normalize(y0), m_directions);
+
+        // removes the CORDIC gain and the scale with rounding
+        auto const restore = [shift](work_type const _c) {
+            std::int64_t const c = static_cast<std::int64_t>(_c.value());
+            std::uint64_t const magnitude = libq::details::mulhi(
+                static_cast<std::uint64_t>((c < 0) ? -c : c), inv_gain);
+            std::int64_t const scaled = (shift > 0) ?
+                static_cast<std::int64_t>(
+                    (magnitude + (std::uint64_t(1u) << (shift - 1))) >> shift) :  // NOLINT
+                static_cast<std::int64_t>(magnitude << (-shift));
+
+            return result_type::wrap(
+                static_cast<typename result_type::storage_type>(
+                    (c < 0) ? -scaled : scaled));
+        };
+
+        return std::make_pair(restore(v.first), restore(v.second));
+    }
+
+ private:
+    int m_quadrant;
+    typename engine_type::directions_type m_directions;
+};
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+/*!
+ \brief Rotates the vector (x, y) by the angle by the single CORDIC pass.
+ \tparam bits number of accurate fractional bits the caller needs
+ \return the pair of the rotated coordinates
+ \details It does not compute the sine and the cosine of the angle, so no
+ fixed-point multiplications are needed: CORDIC rotates the vector itself.
+ The vector is scaled to \f$[0.5, 1)\f$ like libq::polar does, and the
+ scaled vector keeps all the bits of the coordinates, so the absolute
+ precision is the same for short and long vectors. The CORDIC gain is
+ removed by the single 64-bit integer multiplication by the reciprocal of
+ libq::cordic::lut::circular_scale.
+ \note The absolute error of the coordinates is bounded by
+ libq::details::precision_traits<bits, f>::error_bound() plus one ulp of the
+ result.
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up,
+         typename A>
+std::pair<
+    typename libq::details::rotate_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type,  // NOLINT
+    typename libq::details::rotate_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type>  // NOLINT
+    rotate(libq::fixed_point<T, n, f, e, op, up> _x,
+           libq::fixed_point<T, n, f, e, op, up> _y,
+           A _angle) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+
+    return libq::details::rotator<bits, Q>(_angle)(_x, _y);
+}
+
+
+template<typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up,
+         typename A>
+std::pair<
+    typename libq::details::rotate_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type,  // NOLINT
+    typename libq::details::rotate_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type>  // NOLINT
+    rotate(libq::fixed_point<T, n, f, e, op, up> _x,
+           libq::fixed_point<T, n, f, e, op, up> _y,
+           A _angle) {
+    return libq::rotate<f>(_x, _y, _angle);
+}
+
+
+/*!
+ \brief Rotates the vectors \f$(x_i, y_i)\f$ by the same angle.
+ \tparam bits number of accurate fractional bits, see libq::rotate
+ \param _first_x, _last_x range of x coordinates
+ \param _first_y beginning of y coordinates
+ \param _angle the angle of rotation
+ \param _result_x, _result_y beginnings of the rotated coordinates of type
+ libq::details::rotate_of<Q>::promoted_type
+ \details The angle is reduced and the CORDIC directions are found once, so
+ every vector costs shifts and adds of the CORDIC pass only.
+*/
+template<std::size_t bits,
+         class InputIterator,
+         class OutputIterator,
+         typename A>
+void rotate(InputIterator _first_x,
+            InputIterator _last_x,
+            InputIterator _first_y,
+            A _angle,
+            OutputIterator _result_x,
+            OutputIterator _result_y) {
+    using Q = typename std::iterator_traits<InputIterator>::value_type;
+
+    libq::details::rotator<bits, Q> const rotator(_angle);
+    for (; _first_x != _last_x; ++_first_x, ++_first_y) {
+        auto const v = rotator(*_first_x, *_first_y);
+
+        *_result_x++ = v.first;
+        *_result_y++ = v.second;
+    }
+}
+
+
+template<class InputIterator, class OutputIterator, typename A>
+void rotate(InputIterator _first_x,
+            InputIterator _last_x,
+            InputIterator _first_y,
+            A _angle,
+            OutputIterator _result_x,
+            OutputIterator _result_y) {
+    using Q = typename std::iterator_traits<InputIterator>::value_type;
+
+    libq::rotate<Q::bits_for_fractional>(_first_x,
+                                         _last_x,
+                                         _first_y,
+                                         _angle,
+                                         _result_x,
+                                         _result_y);
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_ROTATE_INL_
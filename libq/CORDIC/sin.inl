@@ -38,73 +38,97 @@ class sin_of<libq::fixed_point<T, n, f, e, op, up> >
 }  // namespace libq
 
 
-namespace std {
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+namespace libq {
+/*!
+ \brief Computes the sine by CORDIC with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits the caller needs
+ \note The absolute error is bounded by
+ libq::details::precision_traits<bits, f>::error_bound().
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
 typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
     sin(libq::fixed_point<T, n, f, e, op, up> _val) {
     using sin_type =
         typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+    using precision = libq::details::precision_traits<bits, f>;
 
-    // gap in 3 bits is needed for CONST_PI existence
-    using work_type = libq::Q<f + 3u, f, e, op, up>;
+    // gap in 3 bits is needed for the CORDIC gain
+    using work_type =
+        libq::Q<precision::bits_for_fractional + 3u,
+                precision::bits_for_fractional, e, op, up>;
 
     // convergence interval for CORDIC rotations is [-pi/2, pi/2].
-    // So anyone must map the input angle to that interval
+    // So x = k * pi/2 + r, where r is from [-pi/4, pi/4], and
+    // sin(x) is one of sin(r), cos(r), -sin(r), -cos(r) depending on k mod 4
     work_type arg(0);
-    int sign(1);
-    {
-        // reduce the argument to interval [-pi, +pi] and preserve its sign
-        work_type const x = work_type::CONST_PI -
-            std::fmod(_val, work_type::CONST_2PI);
-        if (x < -work_type::CONST_PI_2) {
-            arg = x + work_type::CONST_PI;
-
-            sign = -1;
-        } else if (x > work_type::CONST_PI_2) {
-            arg = x - work_type::CONST_PI;
-
-            sign = -1;
-        } else {
-            arg = x;
-        }
+    int const quadrant = libq::details::reduce_angle(_val, arg);
+
+    work_type y, x;
+    libq::details::sincos<precision::iterations>(arg, y, x);
+
+    switch (quadrant) {
+    case 0:
+        return sin_type(y);
+    case 1:
+        return sin_type(x);
+    case 2:
+        return sin_type(-y);
+    default:
+        return sin_type(-x);
+    }
+}
+}  // namespace libq
+
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the sine by the engine.
+*/
+template<class Engine>
+class sin_impl;
+
+
+template<>
+class sin_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        return libq::sin<f>(_val);
     }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the sine by the chosen engine.
+ \tparam Engine libq::engine::cordic, libq::engine::cordic_radix4,
+ libq::engine::polynomial or libq::engine::table
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    sin(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::sin_impl<Engine>::apply(_val);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    sin(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::sin>::type;
 
-    using lut_type = libq::cordic::lut<f, work_type>;
-    static auto const angles = lut_type::circular();
-
-    // normalization factor: see page 10, table 24.1 and pages 4-5, equations
-    // (5)-(6)
-    // factor converges to the limit 1.64676 very fast: it takes just 8
-    // iterations.
-    // 8 iterations corresponds to precision of size 0.007812 for the angle
-    // approximation
-    static work_type norm_factor(1.0 / lut_type::circular_scale(f));
-
-    // rotation mode: see page 6
-    // shift sequence is just 0, 1, ... (circular coordinate system)
-    work_type x(norm_factor), y(0.0), z(arg);
-    work_type x1, y1, z1;
-
-#ifdef LOOP_UNROLLING
-    auto const iteration_body = [&](std::size_t i) {  // NOLINT
-#else
-    for (std::size_t i = 0; i != f; ++i) {
-#endif
-        int const sign = (z > work_type(0)) ? 1 : -1;
-        work_type const x_scaled = work_type::wrap(sign * (x.value() >> i));
-        work_type const y_scaled = work_type::wrap(sign * (y.value() >> i));
-
-        x1 = work_type(x - y_scaled);
-        y1 = work_type(y + x_scaled);
-        z1 = work_type(z - work_type((sign > 0) ? angles[i] : -angles[i]));
-
-        x = x1; y = y1; z = z1;
-    };  // NOLINT
-#ifdef LOOP_UNROLLING
-    libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f-1>());
-#endif
-
-    return sin_type((sign > 0) ? y : -y);
+    return libq::sin<engine_type>(_val);
 }
 }  // namespace std
 
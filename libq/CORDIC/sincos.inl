@@ -0,0 +1,49 @@
+// sincos.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sincos.inl
+
+ Provides the CORDIC rotation shared by sin and cos functions
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_CORDIC_SINCOS_INL_
+#define INC_LIBQ_CORDIC_SINCOS_INL_
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes both sine and cosine of the reduced angle by the single
+ CORDIC rotation.
+ \param _angle is from the convergence interval
+ \f$[-\frac{\pi}{2}, \frac{\pi}{2}]\f$
+*/
+template<std::size_t iterations, typename work_type>
+void sincos(work_type const _angle, work_type& _sin, work_type& _cos) {
+    using engine_type = libq::cordic::engine<libq::cordic::rotation,
+                                             libq::cordic::circular,
+                                             work_type,
+                                             iterations>;
+
+    // normalization factor: see page 10, table 24.1 and pages 4-5, equations
+    // (5)-(6)
+    // factor converges to the limit 1.64676 very fast: it takes just 8
+    // iterations.
+    // 8 iterations corresponds to precision of size 0.007812 for the angle
+    // approximation
+    static work_type const norm_factor(1.0 / engine_type::gain());
+
+    // rotation mode: see page 6
+    typename engine_type::state_type const state =
+        engine_type::apply(norm_factor, work_type(0.0), _angle);
+
+    _sin = std::get<1>(state);
+    _cos = std::get<0>(state);
+}
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_SINCOS_INL_
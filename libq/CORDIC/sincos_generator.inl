@@ -0,0 +1,204 @@
+// sincos_generator.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sincos_generator.inl
+
+ Provides the generator of sines and cosines of the evenly spaced angles by
+ the complex rotation recurrence anchored by CORDIC
+*/
+
+#ifndef INC_LIBQ_CORDIC_SINCOS_GENERATOR_INL_
+#define INC_LIBQ_CORDIC_SINCOS_GENERATOR_INL_
+
+#include <cstdint>
+#include <utility>
+
+namespace libq {
+/*!
+ \brief Generates \f$\sin (a + k \Delta)\f$ and \f$\cos (a + k \Delta)\f$
+ for \f$k = 0, 1, 2, ...\f$
+ \tparam Q fixed-point type of the angles a and \f$\Delta\f$
+ \details The point \f$(\cos \phi_k, \sin \phi_k)\f$ is rotated by
+ \f$\Delta\f$:
+ \f[
+    c_{k + 1} = c_k \cos \Delta - s_k \sin \Delta, \quad
+    s_{k + 1} = s_k \cos \Delta + c_k \sin \Delta
+ \f]
+ in 64-bit integers with 60 fractional bits, so every point costs four
+ integer multiplications instead of the CORDIC pass. The rounding errors of
+ the recurrence and of \f$\cos \Delta\f$ and \f$\sin \Delta\f$ accumulate, so
+ every anchor_period points the recurrence is re-anchored by std::sin and
+ std::cos of the exact angle \f$a + k \Delta\f$: it is kept by the 64-bit
+ fixed-point number with the fractional bits of Q.
+ \note The absolute error is the one of std::sin of Q plus
+ \f$anchor\_period \cdot 2^{-52}\f$ and 0.5 ulp of the result format. The
+ angle \f$a + k \Delta\f$ must fit the 64-bit stored integer.
+
+ <B>Usage</B>
+ \code{.cpp}
+    using Q = libq::Q<20, 16>;
+
+    // twiddle factors exp(-2 pi i k / N) of FFT of size N = 1024
+    libq::sincos_generator<Q> twiddles(Q(0.0), Q(-6.283185307179586 / 1024));
+
+    std::array<libq::Q<17, 16>, 1024> sines, cosines;
+    twiddles.generate(1024, sines.begin(), cosines.begin());
+ \endcode
+*/
+template<typename Q>
+class sincos_generator {
+    using this_class = sincos_generator<Q>;
+
+    enum: int {
+        fractional = static_cast<int>(Q::bits_for_fractional) +
+            Q::scaling_factor_exponent,
+
+        // the step constants are accurate to 2^{-52}, so the drift of
+        // 2^{50 - f} points stays below a quarter of ulp
+        log2_period = (50 - fractional < 0) ? 0 :
+                      (50 - fractional > 12) ? 12 : 50 - fractional
+    };
+
+    static_assert(fractional <= 60,
+                  "the recurrence keeps 60 fractional bits");
+
+    // exact angles a + k * step
+    using angle_type = libq::fixed_point<std::int64_t,
+                                         63u - Q::bits_for_fractional,
+                                         Q::bits_for_fractional,
+                                         Q::scaling_factor_exponent,
+                                         typename Q::overflow_policy,
+                                         typename Q::underflow_policy>;
+    using work_type = libq::Q<63, 60>;
+
+ public:
+    using result_type = typename libq::details::sin_of<Q>::promoted_type;
+
+    enum: std::size_t {
+        anchor_period = std::size_t(1u) << log2_period  ///< points per anchor
+    };
+
+    /*!
+     \brief Prepares the sequence from the angle _first with the step _step.
+     \details \f$\cos \Delta\f$ and \f$\sin \Delta\f$ are computed once by
+     CORDIC of the reduced step with 60 fractional bits.
+    */
+    sincos_generator(Q const _first, Q const _step)
+        : m_first(static_cast<std::int64_t>(_first.value())),
+          m_step(static_cast<std::int64_t>(_step.value())),
+          m_index(0u),
+          m_cos_step(0),
+          m_sin_step(0),
+          m_cos(0),
+          m_sin(0) {
+        work_type r(0);
+        int const quadrant = libq::details::reduce_angle(_step, r);
+
+        std::int64_t const s = this_class::widened(std::sin(r));
+        std::int64_t const c = this_class::widened(std::cos(r));
+        switch (quadrant) {
+        case 0:
+            m_sin_step = s;
+            m_cos_step = c;
+            break;
+        case 1:
+            m_sin_step = c;
+            m_cos_step = -s;
+            break;
+        case 2:
+            m_sin_step = -s;
+            m_cos_step = -c;
+            break;
+        default:
+            m_sin_step = -c;
+            m_cos_step = s;
+            break;
+        }
+    }
+
+    /*!
+     \brief Gets the index k of the next point.
+    */
+    std::size_t index() const { return m_index; }
+
+    /*!
+     \brief Gets the sine and the cosine of the next angle
+     \f$a + k \Delta\f$ and advances k.
+    */
+    std::pair<result_type, result_type> operator()() {
+        if ((m_index & (anchor_period - 1u)) == 0u) {
+            this->anchor();
+        }
+
+        std::pair<result_type, result_type> const result(
+            libq::details::round_to<result_type>(m_sin),
+            libq::details::round_to<result_type>(m_cos));
+
+        std::int64_t const c =
+            libq::details::mulshift(m_cos, m_cos_step, 60u) -
+            libq::details::mulshift(m_sin, m_sin_step, 60u);
+        m_sin = libq::details::mulshift(m_sin, m_cos_step, 60u) +
+            libq::details::mulshift(m_cos, m_sin_step, 60u);
+        m_cos = c;
+        ++m_index;
+
+        return result;
+    }
+
+    /*!
+     \brief Generates the next _count points.
+     \param _sin, _cos beginnings of the sines and the cosines of type
+     result_type
+    */
+    template<class SinIterator, class CosIterator>
+    void generate(std::size_t const _count,
+                  SinIterator _sin,
+                  CosIterator _cos) {
+        for (std::size_t i = 0u; i != _count; ++i) {
+            std::pair<result_type, result_type> const v = (*this)();
+
+            *_sin++ = v.first;
+            *_cos++ = v.second;
+        }
+    }
+
+ private:
+    /*!
+     \brief Converts the sine or the cosine to 60 fractional bits.
+    */
+    template<typename R>
+    static std::int64_t widened(R const _x) {
+        enum: int {
+            bits = static_cast<int>(R::bits_for_fractional) +
+                R::scaling_factor_exponent
+        };
+
+        std::int64_t const x = static_cast<std::int64_t>(_x.value());
+        return (bits <= 60) ? x * (std::int64_t(1) << (60 - bits)) :
+                              x / (std::int64_t(1) << (bits - 60));
+    }
+
+    void anchor() {
+        angle_type const angle = angle_type::wrap(
+            m_first + static_cast<std::int64_t>(m_index) * m_step);
+
+        m_sin = this_class::widened(std::sin(angle));
+        m_cos = this_class::widened(std::cos(angle));
+    }
+
+    std::int64_t m_first;
+    std::int64_t m_step;
+    std::size_t m_index;
+
+    std::int64_t m_cos_step;
+    std::int64_t m_sin_step;
+
+    std::int64_t m_cos;
+    std::int64_t m_sin;
+};
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_SINCOS_GENERATOR_INL_
@@ -0,0 +1,143 @@
+// sinhcosh.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sinhcosh.inl
+
+ Provides CORDIC for the joint computation of sinh and cosh functions
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_CORDIC_SINHCOSH_INL_
+#define INC_LIBQ_CORDIC_SINHCOSH_INL_
+
+#include <boost/integer/static_min_max.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the format of the hyperbolic sines and cosines of the
+ fixed-point numbers.
+*/
+template<typename T>
+class sinh_of {
+    using promoted_type = T;
+};
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class sinh_of<libq::fixed_point<T, n, f, e, op, up> > {
+ public:
+    using promoted_type = libq::fixed_point<
+                                std::intmax_t,
+                                std::numeric_limits<std::intmax_t>::digits - f,
+                                f,
+                                e,
+                                op,
+                                up>;
+};
+
+
+/*!
+ \brief Computes both hyperbolic sine and cosine of the reduced argument by
+ the single CORDIC rotation.
+ \param _arg is from the convergence interval \f$[-1.118, 1.118]\f$
+ \note Shifts 1, 2, ..., iterations are used. Shifts 4, 13, 40, ... are
+ repeated for convergence.
+*/
+template<std::size_t iterations, typename work_type>
+void sinhcosh(work_type const _arg, work_type& _sinh, work_type& _cosh) {
+    using engine_type = libq::cordic::engine<libq::cordic::rotation,
+                                             libq::cordic::hyperbolic,
+                                             work_type,
+                                             iterations>;
+
+    static work_type const norm_factor(1.0 / engine_type::gain());
+
+    // rotation mode in hyperbolic coordinates: see page 5, m = -1
+    typename engine_type::state_type const state =
+        engine_type::apply(norm_factor, work_type(0.0), _arg);
+
+    _sinh = std::get<1>(state);
+    _cosh = std::get<0>(state);
+}
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+/*!
+ \brief Computes both hyperbolic sine and cosine by the single CORDIC
+ rotation.
+ \tparam bits number of accurate fractional bits of \f$e^r\f$,
+ \f$r \in [-\frac{\ln 2}{2}, \frac{\ln 2}{2}]\f$
+ \return the pair of \f$\sinh x\f$ and \f$\cosh x\f$
+ \details The argument is reduced as \f$x = k \ln 2 + r\f$. CORDIC gives
+ \f$\sinh r\f$ and \f$\cosh r\f$, so \f$e^{\pm x} = 2^{\pm k}
+ (\cosh r \pm \sinh r)\f$ costs just shifts. The CORDIC pass keeps the
+ guard bits even if bits = f, and \f$\frac{e^{\pm x}}{2}\f$ are rounded to
+ the format of the result after the shifts, see
+ libq::details::scale_by_power_of_two: the shift by k does not amplify the
+ rounding error, and the overflow is raised by the overflow policy.
+ \note The error is bounded by
+ libq::details::precision_traits<bits, f>::error_bound() relative to
+ \f$\cosh x\f$ plus one ulp of the result.
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+std::pair<
+    typename libq::details::sinh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type,  // NOLINT
+    typename libq::details::sinh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type>  // NOLINT
+    sinhcosh(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using sinh_type = typename libq::details::sinh_of<Q>::promoted_type;
+
+    // the work type of 60 fractional bits keeps 4 guard bits at least
+    enum: std::size_t {
+        accurate_bits = boost::static_unsigned_min<bits, 56u>::value
+    };
+    using precision = libq::details::precision_traits<accurate_bits, 60u>;
+
+    // 2 bits for integer part keep the CORDIC gain 1/0.828
+    using work_type = libq::Q<precision::bits_for_fractional + 2u,
+                              precision::bits_for_fractional,
+                              0,
+                              op,
+                              up>;
+
+    work_type r(0);
+    std::int64_t const k =
+        libq::details::reduce<libq::details::ln2_constant>(_val, r);
+
+    work_type s, c;
+    libq::details::sinhcosh<precision::iterations>(r, s, c);
+
+    // e^{r} and e^{-r} from [0.7, 1.42] with 62 fractional bits
+    std::size_t const shift = 62u - precision::bits_for_fractional;
+    std::uint64_t const a =
+        static_cast<std::uint64_t>(work_type(c + s).value()) << shift;
+    std::uint64_t const b =
+        static_cast<std::uint64_t>(work_type(c - s).value()) << shift;
+
+    // e^{x}/2 and e^{-x}/2: the smaller one vanishes if it is shifted out
+    sinh_type const half_a =
+        libq::details::scale_by_power_of_two<sinh_type>(a, k - 1);
+    sinh_type const half_b =
+        libq::details::scale_by_power_of_two<sinh_type>(b, -k - 1);
+
+    return std::make_pair(sinh_type(half_a - half_b),
+                          sinh_type(half_a + half_b));
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_CORDIC_SINHCOSH_INL_
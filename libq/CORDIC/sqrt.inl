@@ -6,13 +6,17 @@
 /*!
  \file sqrt.inl
 
- Provides CORDIC for sqrt function
- \ref see see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+ Provides the engines for sqrt function:
+ 1. CORDIC, see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures",
+ 2. digit-by-digit square root of the stored integer (default one).
 */
 
 #ifndef INC_STD_SQRT_INL_
 #define INC_STD_SQRT_INL_
 
+#include <algorithm>
+#include <cstdint>
+
 namespace libq {
 namespace details {
 
@@ -39,113 +43,173 @@ class sqrt_of {
                                             op,
                                             up>;
 };
-}  // namespace details
-}  // namespace libq
 
-namespace std {
 
 /*!
- \brief computes square root by CORDIC-algorithm
- \ref page 11
+ \brief Computes the square root of the non-negative argument by the engine.
 */
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
-typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type
-    sqrt(libq::fixed_point<T, n, f, e, op, up> const& _val) {
-    using Q = libq::fixed_point<T, n, f, e, op, up>;
-    using sqrt_type =
-        typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type;
+template<class Engine>
+class sqrt_impl;
 
-    assert(("[std::sqrt] argument is negative", _val >= Q(0)));
-    if (_val < Q(0)) {
-        throw std::logic_error("[std::sqrt]: argument is negative");
-    }
-    if (_val == Q(0.0)) {
-        return sqrt_type(0.0);
-    }
-    if (_val == Q(1.0)) {
-        return sqrt_type(1.0);
-    }
 
-    // Work fixed-point format must have several bits to represent
-    // lut. Also format must enable argument translating to interval [1.0, 2.0].
-    // So format must reserve two bits at least for integer part.
-    using work_type = libq::Q<f + 2u, f, e, op, up>;
-    using lut_type = libq::cordic::lut<f, work_type>;
+/*!
+ \brief Computes square root by CORDIC-algorithm
+ \ref page 11
+*/
+template<>
+class sqrt_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using Q = libq::fixed_point<T, n, f, e, op, up>;
+        using sqrt_type =
+            typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type;
+
+        if (_val == Q(0.0)) {
+            return sqrt_type(0.0);
+        }
+        if (_val == Q(1.0)) {
+            return sqrt_type(1.0);
+        }
 
-    using reduced_type = typename std::conditional<Q::bits_for_integral >= 2,
-                                                   Q,
-                                                   work_type>::type;
+        // Work fixed-point format must have several bits to represent
+        // lut. Also format must enable argument translating to interval
+        // [1.0, 2.0]. So format must reserve two bits at least for integer
+        // part.
+        using work_type = libq::Q<f + 2u, f, e, op, up>;
+
+        using reduced_type =
+            typename std::conditional<Q::bits_for_integral >= 2,
+                                      Q,
+                                      work_type>::type;
+
+        // reduces argument to interval [1.0, 2.0] by the single shift
+        reduced_type arg(_val);
+        int const power =
+            static_cast<int>(reduced_type::bits_for_fractional) + e -
+                libq::details::msb(arg.value());
+        if (power >= 0) {
+            libq::lift(arg) <<= power;
+        } else {
+            libq::lift(arg) >>= (-power);
+        }
 
-    int power(0);
-    reduced_type arg(_val);
+        // CORDIC vectoring mode in hyperbolic coordinates: the table and the
+        // gain are built once per format
+        using engine_type = libq::cordic::engine<libq::cordic::vectoring,
+                                                 libq::cordic::hyperbolic,
+                                                 work_type,
+                                                 f>;
+        static typename libq::UQ<f, f, e, op, up> const norm(
+            engine_type::gain());
+
+        // x = sqrt((a + 1/4)^2 - (a - 1/4)^2) * gain
+        typename engine_type::state_type const state = engine_type::apply(
+            work_type(work_type(arg) + 0.25),
+            work_type(work_type(arg) - 0.25),
+            work_type(arg));
+        work_type const x = std::get<0>(state);
+
+        reduced_type result(x / norm);
+        if (power > 0) {
+            libq::lift(result) >>= (power >> 1u);
+            if (power & 1u) {
+                result = result / reduced_type::CONST_SQRT2;
+            }
+        } else {
+            std::size_t const p(-power);
+            libq::lift(result) <<= (p >> 1u);
+            if (p & 1u) {
+                result = result * work_type::CONST_SQRT2;
+            }
+        }
 
-    while (arg >= reduced_type(2.0)) {
-        libq::lift(arg) >>= 1u;
-        power--;
-    }
-    while (arg < reduced_type(1.0)) {
-        libq::lift(arg) <<= 1u;
-        power++;
+        return sqrt_type(result);
     }
+};
 
-    // CORDIC vectoring mode:
-    lut_type const angles = lut_type::hyperbolic_wo_repeated_iterations();
-    typename libq::UQ<f, f, e, op, up> const norm(
-                       lut_type::hyperbolic_scale_with_repeated_iterations(f));
-    work_type x(work_type(arg) + 0.25), y(work_type(arg) - 0.25), z(arg);
-    {
-        std::size_t repeated(4u);
-        std::size_t num(0);
-
-#ifdef LOOP_UNROLLING
-        auto const iteration_body = [&](std::size_t i) {  // NOLINT
-#else
-        for (std::size_t i = 1u; i < f + 1u; ++i) {
-#endif
-            int const sign = ((x.value() < 0)? -1 : +1) *
-                ((y.value() < 0)? -1 : +1);
-            typename work_type::storage_type const store(x.value());
-            x = x - work_type::wrap(sign * (y.value() >> (num + 1u)));
-            y = y - work_type::wrap(sign * (store >> (num + 1u)));
-            z = (sign > 0) ? z + angles[num] : z - angles[num];
-
-            // repeat until convergence is reached
-            if (i == repeated && i != n - 1) {
-                int const sign = ((x.value() < 0)? -1 : +1) *
-                    ((y.value() < 0)? -1 : +1);
-                typename work_type::storage_type const store(x.value());
-                x = x - work_type::wrap(sign * (y.value() >> (num + 1u)));
-                y = y - work_type::wrap(sign * (store >> (num + 1u)));
-                z = (sign > 0) ? z + angles[num] : z - angles[num];
-
-                i += 1u;
-                repeated = 3u * repeated  + 1u;
-            }
 
-            num += 1u;
-        };  // NOLINT
-#ifdef LOOP_UNROLLING
-        libq::details::unroll(iteration_body,
-                              0u,
-                              libq::details::loop_size<f>());
-#endif
+/*!
+ \brief Computes square root by the digit-by-digit method on the stored
+ integer.
+ \details The stored integer is shifted to carry twice as many fractional
+ bits as the result, so the integer square root gives the stored integer of
+ the result. It is rounded to the nearest one, i.e. the error is within
+ 0.5 ulp of the result. The number of steps is the half of the number of
+ significant bits, there are no tables.
+*/
+template<>
+class sqrt_impl<libq::engine::digit_by_digit> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using Q = libq::fixed_point<T, n, f, e, op, up>;
+        using sqrt_type =
+            typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type;
+        using storage_type = typename sqrt_type::storage_type;
+
+        enum: int {
+            input_fractional = static_cast<int>(f) + e,
+            output_fractional = static_cast<int>(sqrt_type::bits_for_fractional) +  // NOLINT
+                sqrt_type::scaling_factor_exponent,
+            shift = 2 * output_fractional - input_fractional,
+            left_shift = (shift > 0) ? shift : 0,
+            right_shift = (shift < 0) ? -shift : 0
+        };
+        static_assert(Q::number_of_significant_bits + left_shift <= 64u,
+                      "the shifted stored integer must fit the 64-bit word");  // NOLINT
+
+        std::uint64_t const radicand =
+            (static_cast<std::uint64_t>(_val.value()) << left_shift) >>
+                right_shift;
+
+        // rounding of the largest argument can exceed the format
+        std::uint64_t const largest =
+            libq::details::largest_stored<sqrt_type>();
+
+        return sqrt_type::wrap(static_cast<storage_type>(
+            std::min(libq::details::isqrt(radicand), largest)));
     }
+};
+}  // namespace details
+}  // namespace libq
 
-    reduced_type result(x / norm);
-    if (power > 0) {
-        libq::lift(result) >>= (power >> 1u);
-        if (power & 1u) {
-            result = result / reduced_type::CONST_SQRT2;
-        }
-    } else {
-        std::size_t const p(-power);
-        libq::lift(result) <<= (p >> 1u);
-        if (p & 1u) {
-            result = result * work_type::CONST_SQRT2;
-        }
+
+namespace libq {
+/*!
+ \brief Computes the square root by the chosen engine.
+ \tparam Engine libq::engine::digit_by_digit, libq::engine::cordic or
+ libq::engine::table
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type
+    sqrt(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+
+    assert(("[libq::sqrt] argument is negative", _val >= Q(0)));
+    if (_val < Q(0)) {
+        throw std::logic_error("[libq::sqrt]: argument is negative");
     }
 
-    return sqrt_type(result);
+    return libq::details::sqrt_impl<Engine>::apply(_val);
+}
+}  // namespace libq
+
+namespace std {
+
+/*!
+ \brief computes square root by the engine of the type, see libq::engine_of
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type
+    sqrt(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::sqrt>::type;
+
+    return libq::sqrt<engine_type>(_val);
 }
 }  // namespace std
 
@@ -33,15 +33,25 @@ class tan_of<libq::fixed_point<T, n, f, e, op, up> >
 }  // namespace libq
 
 
-namespace std {
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+namespace libq {
+/*!
+ \brief Computes the tangent by CORDIC with the reduced number of iterations.
+ \tparam bits number of accurate fractional bits of sine and cosine
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
 typename libq::details::tan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
     tan(libq::fixed_point<T, n, f, e, op, up> _val) {
     using Q = libq::fixed_point<T, n, f, e, op, up>;
     using tan_type = typename libq::details::tan_of<Q>::promoted_type;
 
-    auto const x = std::sin(_val);
-    auto const y = std::cos(_val);
+    auto const x = libq::sin<bits>(_val);
+    auto const y = libq::cos<bits>(_val);
 
     if (!y) {
         throw std::logic_error("[std::tan] argument is equal to 0");
@@ -49,6 +59,15 @@ typename libq::details::tan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted
 
     return tan_type(x/y);
 }
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::tan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    tan(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::tan<f>(_val);
+}
 }  // namespace std
 
 #endif  // INC_STD_SIN_INL_
@@ -6,18 +6,24 @@
 /*!
  \file tanh.inl
 
- Provides CORDIC for tanh function as a ratio of sinh and tanh
+ Provides CORDIC for tanh function as a ratio of sinh and cosh
  \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
 */
 
 #ifndef INC_LIBQ_DETAILS_TANH_INL_
 #define INC_LIBQ_DETAILS_TANH_INL_
 
+#include <boost/integer/static_min_max.hpp>
+
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 
 namespace libq {
 namespace details {
 /*!
+ \brief Gets the format of the hyperbolic tangents of the fixed-point
+ numbers.
 */
 template<typename T>
 class tanh_of {
@@ -38,30 +44,133 @@ class tanh_of<libq::fixed_point<T, n, f, e, op, up> >
 }  // namespace libq
 
 
-namespace std {
-template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+namespace libq {
+/*!
+ \brief Computes the hyperbolic tangent by CORDIC with the reduced number of
+ iterations.
+ \tparam bits number of accurate fractional bits, see libq::sinhcosh
+ \details For \f$x = k \ln 2 + r\f$ and \f$k \geq 0\f$:
+ \f$\tanh x = \frac{e^r - 2^{-2k} e^{-r}}{e^r + 2^{-2k} e^{-r}}\f$,
+ where \f$e^{\pm r} = \cosh r \pm \sinh r\f$ are given by the single CORDIC
+ rotation. So numerator and denominator stay in \f$[0.35, 2.5]\f$ and
+ the linear CORDIC completes the result. Both CORDIC passes keep the guard
+ bits even if bits = f, and the ratio is rounded to the format of the
+ result.
+ \note The absolute error is bounded by
+ \f$2 \cdot\f$ libq::details::precision_traits<bits, f>::error_bound()
+ plus one ulp of the result.
+*/
+template<std::size_t bits,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
 typename libq::details::tanh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
     tanh(libq::fixed_point<T, n, f, e, op, up> _val) {
     using Q = libq::fixed_point<T, n, f, e, op, up>;
     using tanh_type = typename libq::details::tanh_of<Q>::promoted_type;
 
-    auto a = std::sinh(_val);
-    auto b = std::cosh(_val);
+    // the work type of 60 fractional bits keeps 4 guard bits at least
+    enum: std::size_t {
+        accurate_bits = boost::static_unsigned_min<bits, 56u>::value
+    };
+    using precision = libq::details::precision_traits<accurate_bits, 60u>;
 
-    // reduce a and b to [0, 1] interval
-    auto m = std::max(std::fabs(a), std::fabs(b));
-    std::size_t shifts(0);
-    while (m >= 1.0) {
-        libq::lift(m) >>= 1u;
-        shifts++;
+    // 2 bits for integer part keep the CORDIC gain 1/0.828 and e^r
+    using work_type = libq::Q<precision::bits_for_fractional + 2u,
+                              precision::bits_for_fractional,
+                              0,
+                              op,
+                              up>;
+
+    work_type r(0);
+    std::int64_t const k =
+        libq::details::reduce<libq::details::ln2_constant>(_val, r);
+
+    work_type s, c;
+    libq::details::sinhcosh<precision::iterations>(r, s, c);
+
+    // e^{r} and e^{-r} scaled by 2^{2k}
+    work_type a(c + s), b(c - s);
+    int const shift = std::min(static_cast<int>(2 * ((k >= 0) ? k : -k)),
+                               std::numeric_limits<typename work_type::storage_type>::digits);  // NOLINT
+    if (k >= 0) {
+        libq::lift(b) >>= shift;
+    } else {
+        libq::lift(a) >>= shift;
     }
-    libq::lift(a) >>= shifts;
-    libq::lift(b) >>= shifts;
 
-    using work_type = typename libq::Q<f, f, e, op, up>;
-    auto const c = tanh_type(work_type(a) / work_type(b));
+    // linear CORDIC in vectoring mode gets the ratio by shifts and adds: it
+    // does not need the double-width division
+    using engine_type = libq::cordic::engine<libq::cordic::vectoring,
+                                             libq::cordic::linear,
+                                             work_type,
+                                             precision::iterations>;
+
+    typename engine_type::state_type const state =
+        engine_type::apply(work_type(a + b), work_type(a - b), work_type(0));
+
+    // rounds the ratio to the format of the result
+    int const ratio_shift =
+        static_cast<int>(precision::bits_for_fractional) -
+        static_cast<int>(tanh_type::bits_for_fractional) -
+        tanh_type::scaling_factor_exponent;
+    std::int64_t const ratio =
+        static_cast<std::int64_t>(std::get<2>(state).value());
+
+    return tanh_type::wrap(static_cast<typename tanh_type::storage_type>(
+        (ratio_shift > 0) ?
+            ((ratio + (std::int64_t(1) << (ratio_shift - 1))) >> ratio_shift) :
+            (ratio << (-ratio_shift))));
+}
+}  // namespace libq
+
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the hyperbolic tangent by the engine.
+*/
+template<class Engine>
+class tanh_impl;
+
+
+template<>
+class tanh_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::tanh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        return libq::tanh<f>(_val);
+    }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the hyperbolic tangent by the chosen engine.
+ \tparam Engine libq::engine::cordic, libq::engine::polynomial or
+ libq::engine::table
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::tanh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    tanh(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::tanh_impl<Engine>::apply(_val);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::tanh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    tanh(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::tanh>::type;
 
-    return tanh_type(c);
+    return libq::tanh<engine_type>(_val);
 }
 }  // namespace std
 
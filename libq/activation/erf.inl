@@ -0,0 +1,175 @@
+// erf.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file erf.inl
+
+ Provides the error function
+*/
+
+#ifndef INC_LIBQ_ACTIVATION_ERF_INL_
+#define INC_LIBQ_ACTIVATION_ERF_INL_
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the type of the error function: the signed number with one bit
+ for integer part, like libq::details::tanh_of does.
+*/
+template<typename T>
+class erf_of {
+ public:
+    using promoted_type = T;
+};
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class erf_of<libq::fixed_point<T, n, f, e, op, up> >
+    : private libq::fixed_point<typename std::make_signed<T>::type, 0, f, e, op, up>,  // NOLINT
+      public type_promotion_base<
+          libq::fixed_point<typename std::make_signed<T>::type, 0, f, e, op, up>,  // NOLINT
+          1u,
+          0,
+          0> {
+};
+
+
+/*!
+ \brief Gets the binary logarithm of the bound \f$2^L\f$ beyond which
+ \f$1 - erf(x)\f$ is less than a half ulp of the result with bits
+ fractional bits: \f$erfc(2) < 2^{-7}\f$, \f$erfc(4) < 2^{-25}\f$ and
+ \f$erfc(8) < 2^{-95}\f$.
+*/
+template<int bits>
+class erf_saturation {
+ public:
+    enum: int {
+        log2_value = (bits + 1 <= 7) ? 1 : (bits + 1 <= 25) ? 2 : 3
+    };
+};
+
+
+/*!
+ \brief Computes the error function by the engine.
+*/
+template<class Engine>
+class erf_impl;
+
+
+/*!
+ \brief Computes the error function by the table with the cubic Hermite
+ interpolation.
+ \details The table samples \f$erf(x)\f$ for \f$x \in [0, 2^L]\f$, see
+ libq::details::erf_saturation: the larger arguments give 1. The function
+ is odd, so the negative arguments are reflected. The derivative sampled for
+ the interpolation is \f$\frac{2}{\sqrt{\pi}} e^{-x^2}\f$.
+ \note The absolute error is bounded by
+ libq::details::hermite_table::error_bound() plus 1 ulp of the result
+ format.
+*/
+template<>
+class erf_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::erf_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using erf_type =
+            typename libq::details::erf_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using format = libq::details::polynomial_format;
+        using saturation =
+            libq::details::erf_saturation<static_cast<int>(f) + e>;
+        using entries = libq::details::hermite_entries<static_cast<int>(f) + e,  // NOLINT
+                                                       saturation::log2_value>;  // NOLINT
+        using table_type = libq::details::hermite_table<entries::log2_value>;
+
+        enum: int { input_fractional = static_cast<int>(f) + e };
+
+        static table_type const values = table_type::sampled(
+            [](double _x) { return std::erf(_x); },
+            [](double _x) { return 1.1283791670955126 * std::exp(-_x * _x); },  // NOLINT
+            0.0,
+            saturation::log2_value);
+
+        std::int64_t const x = static_cast<std::int64_t>(_val.value());
+        bool const negative = (x < 0);
+        std::uint64_t const magnitude = negative ?
+            std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+            static_cast<std::uint64_t>(x);
+
+        // |x| with 56 fractional bits is below 2^{59}
+        std::int64_t result = format::one();
+        if (libq::details::msb(magnitude | 1u) <
+                input_fractional + saturation::log2_value) {
+            std::int64_t const u = (input_fractional <= 56) ?
+                static_cast<std::int64_t>(magnitude << (56 - input_fractional)) :  // NOLINT
+                static_cast<std::int64_t>(magnitude >> (input_fractional - 56));  // NOLINT
+
+            result = values(u, 56);
+        }
+
+        return libq::details::round_to<erf_type>(negative ? -result : result);
+    }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the error function by the chosen engine.
+ \tparam Engine libq::engine::table
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::erf_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    erf(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::erf_impl<Engine>::apply(_val);
+}
+
+
+/*!
+ \brief Computes the error function of the range of fixed-point numbers.
+ \param _first, _last range of the arguments
+ \param _result beginning of the results of type
+ libq::details::erf_of<Q>::promoted_type
+ \return the end of the results
+*/
+template<class Engine, class InputIterator, class OutputIterator>
+OutputIterator erf(InputIterator _first,
+                   InputIterator _last,
+                   OutputIterator _result) {
+    for (; _first != _last; ++_first) {
+        *_result++ = libq::erf<Engine>(*_first);
+    }
+
+    return _result;
+}
+
+
+template<class InputIterator, class OutputIterator>
+OutputIterator erf(InputIterator _first,
+                   InputIterator _last,
+                   OutputIterator _result) {
+    using Q = typename std::iterator_traits<InputIterator>::value_type;
+    using engine_type = typename libq::details::selected_engine<Q, libq::functions::erf>::type;  // NOLINT
+
+    return libq::erf<engine_type>(_first, _last, _result);
+}
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::erf_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    erf(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type = typename libq::details::selected_engine<Q, libq::functions::erf>::type;  // NOLINT
+
+    return libq::erf<engine_type>(_val);
+}
+}  // namespace std
+
+#endif  // INC_LIBQ_ACTIVATION_ERF_INL_
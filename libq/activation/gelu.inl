@@ -0,0 +1,183 @@
+// gelu.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file gelu.inl
+
+ Provides the Gaussian error linear unit (GELU) of the neural networks
+*/
+
+#ifndef INC_LIBQ_ACTIVATION_GELU_INL_
+#define INC_LIBQ_ACTIVATION_GELU_INL_
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the type of GELU: the signed number of the argument's format.
+*/
+template<typename T>
+class gelu_of {
+ public:
+    using promoted_type = T;
+};
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class gelu_of<libq::fixed_point<T, n, f, e, op, up> >
+    : public type_promotion_base<
+          libq::fixed_point<typename std::make_signed<T>::type, n, f, e, op, up>,  // NOLINT
+          0u,
+          0,
+          0> {
+};
+
+
+/*!
+ \brief Gets the binary logarithm of the bound \f$2^L\f$ beyond which
+ \f$|x| \Phi(-|x|)\f$ is less than a half ulp of the result with bits
+ fractional bits: \f$4 \Phi(-4) < 2^{-12}\f$ and
+ \f$8 \Phi(-8) < 2^{-47}\f$.
+*/
+template<int bits>
+class gelu_saturation {
+ public:
+    enum: int {
+        log2_value = (bits + 1 <= 12) ? 2 : (bits + 1 <= 46) ? 3 : 4
+    };
+};
+
+
+/*!
+ \brief Computes GELU by the engine.
+*/
+template<class Engine>
+class gelu_impl;
+
+
+/*!
+ \brief Computes GELU \f$x \Phi(x)\f$ by the table of the normal
+ distribution function \f$\Phi\f$ with the cubic Hermite interpolation.
+ \details The table samples \f$\Phi(x)\f$ for \f$x \in [0, 2^L]\f$, see
+ libq::details::gelu_saturation: the larger arguments give x and the
+ smaller ones give 0. The negative arguments are reflected as
+ \f$\Phi(-x) = 1 - \Phi(x)\f$. So the function costs the lookup and the
+ single 64-bit integer multiplication.
+ \note The absolute error is bounded by \f$2^L\f$
+ libq::details::hermite_table::error_bound() plus 1 ulp of the result
+ format.
+*/
+template<>
+class gelu_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::gelu_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using gelu_type =
+            typename libq::details::gelu_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using format = libq::details::polynomial_format;
+        using saturation =
+            libq::details::gelu_saturation<static_cast<int>(f) + e>;
+        using entries = libq::details::hermite_entries<static_cast<int>(f) + e + saturation::log2_value,  // NOLINT
+                                                       saturation::log2_value>;  // NOLINT
+        using table_type = libq::details::hermite_table<entries::log2_value>;
+
+        enum: int { input_fractional = static_cast<int>(f) + e };
+
+        static table_type const values = table_type::sampled(
+            [](double _x) { return 0.5 * std::erfc(-_x * 0.70710678118654752); },  // NOLINT
+            [](double _x) { return 0.3989422804014327 * std::exp(-0.5 * _x * _x); },  // NOLINT
+            0.0,
+            saturation::log2_value);
+
+        std::int64_t const x = static_cast<std::int64_t>(_val.value());
+        bool const negative = (x < 0);
+        std::uint64_t const magnitude = negative ?
+            std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+            static_cast<std::uint64_t>(x);
+
+        if (libq::details::msb(magnitude | 1u) >=
+                input_fractional + saturation::log2_value) {
+            return libq::details::round_to<gelu_type>(negative ? 0 : x,
+                                                      input_fractional);
+        }
+
+        // |x| with 56 fractional bits is below 2^{60}
+        std::int64_t const u = (input_fractional <= 56) ?
+            static_cast<std::int64_t>(magnitude << (56 - input_fractional)) :
+            static_cast<std::int64_t>(magnitude >> (input_fractional - 56));
+
+        std::int64_t const p = values(u, 56);
+        std::int64_t const y = libq::details::mulshift(
+            u, negative ? format::one() - p : p, 60u);
+
+        return libq::details::round_to<gelu_type>(negative ? -y : y, 56);
+    }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the Gaussian error linear unit
+ \f$GELU(x) = x \Phi(x) = \frac{x}{2} (1 + erf \frac{x}{\sqrt{2}})\f$ by the
+ chosen engine.
+ \tparam Engine libq::engine::table
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::gelu_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    gelu(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::gelu_impl<Engine>::apply(_val);
+}
+
+
+/*!
+ \brief Computes GELU by the engine of the type, see libq::engine_of.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::gelu_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    gelu(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::gelu>::type;
+
+    return libq::gelu<engine_type>(_val);
+}
+
+
+/*!
+ \brief Computes GELU of the range of fixed-point numbers.
+ \param _first, _last range of the arguments
+ \param _result beginning of the results of type
+ libq::details::gelu_of<Q>::promoted_type
+ \return the end of the results
+*/
+template<class Engine, class InputIterator, class OutputIterator>
+OutputIterator gelu(InputIterator _first,
+                    InputIterator _last,
+                    OutputIterator _result) {
+    for (; _first != _last; ++_first) {
+        *_result++ = libq::gelu<Engine>(*_first);
+    }
+
+    return _result;
+}
+
+
+template<class InputIterator, class OutputIterator>
+OutputIterator gelu(InputIterator _first,
+                    InputIterator _last,
+                    OutputIterator _result) {
+    using Q = typename std::iterator_traits<InputIterator>::value_type;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::gelu>::type;
+
+    return libq::gelu<engine_type>(_first, _last, _result);
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_ACTIVATION_GELU_INL_
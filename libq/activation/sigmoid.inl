@@ -0,0 +1,229 @@
+// sigmoid.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sigmoid.inl
+
+ Provides the logistic function (sigmoid) of the neural networks
+*/
+
+#ifndef INC_LIBQ_ACTIVATION_SIGMOID_INL_
+#define INC_LIBQ_ACTIVATION_SIGMOID_INL_
+
+#include <boost/integer/static_log2.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the type of the logistic function: the unsigned number with one
+ bit for integer part, so 1 is kept exactly.
+*/
+template<typename T>
+class sigmoid_of {
+ public:
+    using promoted_type = T;
+};
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class sigmoid_of<libq::fixed_point<T, n, f, e, op, up> >
+    : private libq::fixed_point<typename std::make_unsigned<T>::type, 0, f, e, op, up>,  // NOLINT
+      public type_promotion_base<
+          libq::fixed_point<typename std::make_unsigned<T>::type, 0, f, e, op, up>,  // NOLINT
+          1u,
+          0,
+          0> {
+};
+
+
+/*!
+ \brief Gets the binary logarithm of the bound \f$2^L\f$ beyond which
+ \f$1 - \sigma(x) < e^{-x}\f$ is less than a half ulp of the result with bits
+ fractional bits, i.e. \f$2^L \geq (bits + 1) \ln 2\f$.
+*/
+template<int bits>
+class sigmoid_saturation {
+    enum: unsigned long {  // NOLINT
+        bound = static_cast<unsigned long>(  // NOLINT
+            ((bits < 1) ? 1 : bits + 1) * 710 / 1024 + 1)
+    };
+    enum: int {
+        ceil_log2 = static_cast<int>(boost::static_log2<2u * bound - 1u>::value)  // NOLINT
+    };
+
+ public:
+    enum: int {
+        log2_value = (ceil_log2 < 2) ? 2 : (ceil_log2 > 6) ? 6 : ceil_log2
+    };
+};
+
+
+/*!
+ \brief Computes the logistic function by the engine.
+*/
+template<class Engine>
+class sigmoid_impl;
+
+
+/*!
+ \brief Computes the logistic function as
+ \f$\sigma(x) = \frac{1 + \tanh \frac{x}{2}}{2}\f$, see libq::tanh.
+ \details The halving is one more fractional bit of the stored integer, so
+ it is exact.
+ \note The absolute error is a half of the one of libq::tanh plus 0.5 ulp of
+ the result format.
+*/
+template<>
+class sigmoid_impl<libq::engine::cordic> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::sigmoid_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using sigmoid_type =
+            typename libq::details::sigmoid_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using half_type =
+            libq::fixed_point<std::int64_t, n, f + 1u, e, op, up>;
+
+        static_assert(n + f + 1u <= 63u,
+                      "the halved argument must fit 64 bits");
+
+        enum: int { tanh_fractional = static_cast<int>(f) + e + 1 };
+
+        auto const t = libq::tanh<f>(half_type::wrap(
+            static_cast<std::int64_t>(_val.value())));
+
+        // (1 + t) with tanh_fractional bits is (1 + t)/2 with one bit more
+        std::int64_t const one = std::int64_t(1) << tanh_fractional;
+        return libq::details::round_to<sigmoid_type>(
+            one + static_cast<std::int64_t>(t.value()), tanh_fractional + 1);
+    }
+};
+
+
+/*!
+ \brief Computes the logistic function by the table with the cubic Hermite
+ interpolation.
+ \details The table samples \f$\sigma(x)\f$ for \f$x \in [0, 2^L]\f$, see
+ libq::details::sigmoid_saturation: the larger arguments give 1. The
+ negative ones are reflected as \f$\sigma(-x) = 1 - \sigma(x)\f$. The
+ derivative sampled for the interpolation is
+ \f$\sigma'(x) = \sigma(x) (1 - \sigma(x))\f$.
+ \note The absolute error is bounded by
+ libq::details::hermite_table::error_bound() plus 1 ulp of the result
+ format.
+*/
+template<>
+class sigmoid_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::sigmoid_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using sigmoid_type =
+            typename libq::details::sigmoid_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using format = libq::details::polynomial_format;
+        using saturation =
+            libq::details::sigmoid_saturation<static_cast<int>(f) + e>;
+        using entries = libq::details::hermite_entries<static_cast<int>(f) + e,  // NOLINT
+                                                       saturation::log2_value>;  // NOLINT
+        using table_type = libq::details::hermite_table<entries::log2_value>;
+
+        enum: int { input_fractional = static_cast<int>(f) + e };
+
+        static table_type const values = table_type::sampled(
+            [](double _x) { return 1.0 / (1.0 + std::exp(-_x)); },
+            [](double _x) {
+                double const s = 1.0 / (1.0 + std::exp(-_x));
+                return s * (1.0 - s);
+            },
+            0.0,
+            saturation::log2_value);
+
+        std::int64_t const x = static_cast<std::int64_t>(_val.value());
+        bool const negative = (x < 0);
+        std::uint64_t const magnitude = negative ?
+            std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+            static_cast<std::uint64_t>(x);
+
+        // |x| with 56 fractional bits is below 2^{62}
+        std::int64_t result = format::one();
+        if (libq::details::msb(magnitude | 1u) <
+                input_fractional + saturation::log2_value) {
+            std::int64_t const u = (input_fractional <= 56) ?
+                static_cast<std::int64_t>(magnitude << (56 - input_fractional)) :  // NOLINT
+                static_cast<std::int64_t>(magnitude >> (input_fractional - 56));  // NOLINT
+
+            result = values(u, 56);
+        }
+
+        return libq::details::round_to<sigmoid_type>(
+            negative ? format::one() - result : result);
+    }
+};
+}  // namespace details
+
+
+/*!
+ \brief Computes the logistic function \f$\sigma(x) = \frac{1}{1 + e^{-x}}\f$
+ by the chosen engine.
+ \tparam Engine libq::engine::table or libq::engine::cordic
+*/
+template<class Engine, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+typename libq::details::sigmoid_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    sigmoid(libq::fixed_point<T, n, f, e, op, up> _val) {
+    return libq::details::sigmoid_impl<Engine>::apply(_val);
+}
+
+
+/*!
+ \brief Computes the logistic function by the engine of the type, see
+ libq::engine_of.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::sigmoid_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    sigmoid(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::sigmoid>::type;  // NOLINT
+
+    return libq::sigmoid<engine_type>(_val);
+}
+
+
+/*!
+ \brief Computes the logistic function of the range of fixed-point numbers.
+ \param _first, _last range of the arguments
+ \param _result beginning of the results of type
+ libq::details::sigmoid_of<Q>::promoted_type
+ \return the end of the results
+*/
+template<class Engine, class InputIterator, class OutputIterator>
+OutputIterator sigmoid(InputIterator _first,
+                       InputIterator _last,
+                       OutputIterator _result) {
+    for (; _first != _last; ++_first) {
+        *_result++ = libq::sigmoid<Engine>(*_first);
+    }
+
+    return _result;
+}
+
+
+template<class InputIterator, class OutputIterator>
+OutputIterator sigmoid(InputIterator _first,
+                       InputIterator _last,
+                       OutputIterator _result) {
+    using Q = typename std::iterator_traits<InputIterator>::value_type;
+    using engine_type =
+        typename libq::details::selected_engine<Q, libq::functions::sigmoid>::type;  // NOLINT
+
+    return libq::sigmoid<engine_type>(_first, _last, _result);
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_ACTIVATION_SIGMOID_INL_
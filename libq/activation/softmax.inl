@@ -0,0 +1,155 @@
+// softmax.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file softmax.inl
+
+ Provides the normalized exponents (softmax) of the neural networks
+*/
+
+#ifndef INC_LIBQ_ACTIVATION_SOFTMAX_INL_
+#define INC_LIBQ_ACTIVATION_SOFTMAX_INL_
+
+#include <cstdint>
+#include <iterator>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the type of softmax: the probabilities are kept like the values
+ of libq::sigmoid.
+*/
+template<typename T>
+class softmax_of
+    : public libq::details::sigmoid_of<T> {
+};
+
+
+/*!
+ \brief Computes \f$e^{-d}\f$ for \f$d \geq 0\f$ given by the difference of
+ the stored integers with _bits fractional bits.
+ \tparam bits number of fractional bits of the result the caller needs: the
+ exponents below \f$2^{-(bits + 3)}\f$ are dropped
+ \return the value from \f$[0, 1]\f$ with 60 fractional bits
+ \details The argument is reduced as \f$-d = k \ln 2 + r\f$, so
+ \f$e^{-d} = 2^k P(r)\f$ is given by the minimax polynomial of the exponent
+ and the single shift, see libq::exp<libq::engine::polynomial>.
+*/
+template<int bits>
+std::int64_t softmax_exponent(std::uint64_t const _d, int const _bits) {
+    using accuracy = libq::details::accuracy_class<bits>;
+    using polynomial =
+        libq::details::minimax<libq::functions::exp, accuracy::value>;
+    using difference_type = libq::Q<62, 56>;
+    using work_type = libq::Q<63, 60>;
+
+    // e^{-64} is below 2^{-92}
+    if (libq::details::msb(_d | 1u) >= _bits + 6) {
+        return 0;
+    }
+
+    // d < 64 with 56 fractional bits is below 2^{62}
+    std::int64_t const d = (_bits <= 56) ?
+        static_cast<std::int64_t>(_d << (56 - _bits)) :
+        static_cast<std::int64_t>(_d >> (_bits - 56));
+
+    work_type r(0);
+    std::int64_t const k = libq::details::reduce<libq::details::ln2_constant>(
+        difference_type::wrap(-d), r);
+    if (-k > bits + 3) {
+        return 0;
+    }
+
+    return libq::details::horner<polynomial>(
+        static_cast<std::int64_t>(r.value())) >> (-k);
+}
+}  // namespace details
+
+
+/*!
+ \brief Computes the normalized exponents
+ \f$y_i = \frac{e^{x_i}}{\sum_j e^{x_j}}\f$ of the range of fixed-point
+ numbers.
+ \param _first, _last range of the arguments
+ \param _result beginning of the results of type
+ libq::details::softmax_of<Q>::promoted_type
+ \return the end of the results
+ \details
+ 1. The maximum \f$m\f$ is subtracted, so the exponents
+ \f$e^{x_i - m} \in (0, 1]\f$ never overflow: they are computed with 60
+ fractional bits, see libq::details::softmax_exponent. The differences
+ of the stored integers are exact.
+ 2. The sum of N exponents is kept by the 64-bit integer with
+ \f$60 - \lceil \log_2 N \rceil\f$ fractional bits.
+ 3. The reciprocal of the sum is computed once by Newton-Raphson iterations,
+ see libq::details::reciprocal, so every result costs the single 64-bit
+ integer multiplication instead of the division.
+
+ The exponents are computed twice rather than kept in the scratch buffer, so
+ the function does not allocate. The range is passed three times.
+ \note The absolute error is bounded by 1 ulp of the result format plus
+ \f$\sqrt{2}\f$ libq::details::minimax<libq::functions::exp, bits>::error_bound().
+*/
+template<class ForwardIterator, class OutputIterator>
+OutputIterator softmax(ForwardIterator _first,
+                       ForwardIterator _last,
+                       OutputIterator _result) {
+    using Q = typename std::iterator_traits<ForwardIterator>::value_type;
+    using softmax_type = typename libq::details::softmax_of<Q>::promoted_type;
+
+    enum: int {
+        input_fractional = static_cast<int>(Q::bits_for_fractional) +
+            Q::scaling_factor_exponent,
+        result_fractional = static_cast<int>(softmax_type::bits_for_fractional) +  // NOLINT
+            softmax_type::scaling_factor_exponent
+    };
+
+    if (_first == _last) {
+        return _result;
+    }
+
+    std::int64_t maximum = static_cast<std::int64_t>(_first->value());
+    std::size_t count(0u);
+    for (ForwardIterator it = _first; it != _last; ++it, ++count) {
+        std::int64_t const x = static_cast<std::int64_t>(it->value());
+        if (x > maximum) {
+            maximum = x;
+        }
+    }
+
+    // x <= m, so m - x does not overflow the unsigned 64-bit word
+    auto const exponent = [maximum](Q const& _x) {
+        return libq::details::softmax_exponent<result_fractional>(
+            static_cast<std::uint64_t>(maximum) -
+                static_cast<std::uint64_t>(_x.value()),
+            input_fractional);
+    };
+
+    // the sum of count exponents not greater than 1 is below 2^{60}
+    int const scale = (count > 1u) ?
+        libq::details::msb(static_cast<std::uint64_t>(count - 1u)) + 1 : 0;
+    std::uint64_t sum(0u);
+    for (ForwardIterator it = _first; it != _last; ++it) {
+        sum += static_cast<std::uint64_t>(exponent(*it)) >> scale;
+    }
+
+    // sum = s 2^{p + 1}, where s from [0.5, 1) has 64 fractional bits
+    int const p = libq::details::msb(sum);
+    std::int64_t const y = libq::details::reciprocal<
+        softmax_type::number_of_significant_bits + 4u>(sum << (63 - p));
+
+    // e / sum = e y 2^{59 - scale - p}, so the product of e and y with 60
+    // fractional bits has scale + p + 1 ones
+    for (; _first != _last; ++_first) {
+        *_result++ = libq::details::round_to<softmax_type>(
+            libq::details::mulshift(exponent(*_first), y, 60u),
+            scale + p + 1);
+    }
+
+    return _result;
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_ACTIVATION_SOFTMAX_INL_
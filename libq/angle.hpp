@@ -0,0 +1,268 @@
+// angle.hpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file angle.hpp
+
+ Provides the binary angle: the unsigned fraction of the full turn.
+*/
+
+#ifndef INC_LIBQ_ANGLE_HPP_
+#define INC_LIBQ_ANGLE_HPP_
+
+#include <boost/integer.hpp>
+
+#include <cmath>
+#include <cstdint>
+
+namespace libq {
+/*!
+ \brief Keeps the angle as the unsigned integer \f$v\f$ that is the fraction
+ \f$\frac{v}{2^{bits}}\f$ of the full turn (binary angle measurement).
+ \tparam bits number of bits of the stored integer, from 4 to 32
+ \details The arithmetics wraps modulo \f$2^{bits}\f$, so the angle is always
+ reduced to one turn without any computations and its quadrant is the two
+ most significant bits. The trigonometric functions of libq/CORDIC/angle.inl
+ skip the range reduction, see libq::sin, libq::cos, libq::sincos and
+ libq::atan2.
+
+ <B>Usage</B>
+ \code{.cpp}
+    using phase_type = libq::angle<16>;
+
+    phase_type phase;
+    phase_type const step = phase_type::from_turns(0.01);
+    for (std::size_t i = 0; i != 1000; ++i) {
+        auto const s = libq::sin(phase);  // libq::Q<15, 14>
+        phase += step;  // wraps around the full turn
+    }
+ \endcode
+*/
+template<std::size_t bits>
+class angle {
+    static_assert(bits >= 4u && bits <= 32u,
+                  "the binary angle has from 4 to 32 bits");
+
+    using this_class = angle<bits>;
+
+ public:
+    using storage_type = typename boost::uint_t<bits>::least;
+
+    enum: std::size_t {
+        bits_for_angle = bits,
+
+        /*!
+         \brief Number of fractional bits of sin and cos of the angle: the
+         angle quantization \f$\frac{2\pi}{2^{bits}}\f$ does not allow more.
+        */
+        bits_for_fractional = bits - 2u
+    };
+
+    angle()
+        : m_value(0) {}
+
+    /*!
+     \brief Converts the angle in radians given by the fixed-point number.
+     \details The argument is reduced by \f$\frac{\pi}{2}\f$ in integers, see
+     libq::details::reduce_angle, so its magnitude is not limited.
+    */
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    explicit angle(libq::fixed_point<T, n, f, e, op, up> const _radians)
+        : m_value(0) {
+        // 6 guard bits for the remainder
+        using remainder_type = libq::Q<bits + 6u, bits + 6u, 0, op, up>;
+
+        remainder_type r(0);
+        std::int64_t const quadrant =
+            libq::details::reduce_angle(_radians, r);
+
+        m_value = this_class::wrap_units(
+            (quadrant << (bits - 2u)) +
+            this_class::units_of(static_cast<std::int64_t>(r.value()),
+                                 static_cast<int>(bits) + 6));
+    }
+
+    /*!
+     \brief Creates the angle by its stored integer.
+    */
+    static this_class wrap(storage_type const _value) {
+        this_class result;
+        result.m_value = this_class::wrap_units(_value);
+
+        return result;
+    }
+
+    /*!
+     \brief Creates the angle by the fraction of the full turn.
+    */
+    static this_class from_turns(double const _turns) {
+        double const fraction = _turns - std::floor(_turns);
+
+        return this_class::wrap(static_cast<storage_type>(
+            std::llround(std::ldexp(fraction, static_cast<int>(bits)))));
+    }
+
+    /*!
+     \brief Creates the angle by the radians kept as the stored integer
+     _value with _f fractional bits.
+     \note The magnitude of the angle must not exceed \f$\pi\f$.
+    */
+    static this_class from_reduced_radians(std::int64_t const _value,
+                                           int const _f) {
+        this_class result;
+        result.m_value = this_class::wrap_units(
+            this_class::units_of(_value, _f));
+
+        return result;
+    }
+
+    storage_type value() const { return m_value; }
+
+    /*!
+     \brief Gets the quadrant index: the two most significant bits.
+    */
+    int quadrant() const { return static_cast<int>(m_value >> (bits - 2u)); }
+
+    /*!
+     \brief Gets the fraction of the full turn in \f$[0, 1)\f$.
+    */
+    double turns() const {
+        return std::ldexp(static_cast<double>(m_value),
+                          -static_cast<int>(bits));
+    }
+
+    /*!
+     \brief Gets the signed stored integer: the angle in
+     \f$[-\pi, \pi)\f$ measured in \f$\frac{1}{2^{bits}}\f$ turns.
+    */
+    std::int64_t signed_value() const {
+        std::int64_t const v = static_cast<std::int64_t>(m_value);
+
+        return (v >= (std::int64_t(1) << (bits - 1u))) ?
+            v - (std::int64_t(1) << bits) : v;
+    }
+
+    /*!
+     \brief Converts the angle to radians in \f$[-\pi, \pi)\f$.
+     \tparam Q fixed-point type that keeps \f$\pi\f$
+    */
+    template<typename Q>
+    Q radians() const {
+        return this_class::radians_of<Q>(this->signed_value());
+    }
+
+    /*!
+     \brief Converts the signed angle measured in \f$\frac{1}{2^{bits}}\f$
+     turns to radians.
+     \param _units angle which magnitude is not greater than the half turn
+    */
+    template<typename Q>
+    static Q radians_of(std::int64_t const _units) {
+        enum: int {
+            fractional = static_cast<int>(Q::bits_for_fractional) +
+                Q::scaling_factor_exponent
+        };
+        static libq::details::scaled_constant<libq::details::pi_2_constant, 61u> const pi_2;  // NOLINT
+
+        // |units| <= 2^(bits - 1) is scaled to 2^61, so the product has
+        // 57 fractional bits
+        std::uint64_t const magnitude = static_cast<std::uint64_t>(
+            (_units < 0) ? -_units : _units) << (62u - bits);
+        std::uint64_t result = libq::details::mulhi(
+            magnitude, static_cast<std::uint64_t>(pi_2.hi));
+        if (fractional < 57) {
+            int const shift = 57 - fractional;
+            result = (result + (std::uint64_t(1u) << (shift - 1))) >> shift;
+        } else {
+            result <<= (fractional - 57);
+        }
+
+        std::int64_t const value = static_cast<std::int64_t>(result);
+        return Q::wrap(static_cast<typename Q::storage_type>(
+            (_units < 0) ? -value : value));
+    }
+
+    this_class& operator+=(this_class const& _x) {
+        m_value = this_class::wrap_units(
+            static_cast<std::int64_t>(m_value) + _x.m_value);
+        return *this;
+    }
+
+    this_class& operator-=(this_class const& _x) {
+        m_value = this_class::wrap_units(
+            static_cast<std::int64_t>(m_value) - _x.m_value);
+        return *this;
+    }
+
+    this_class& operator*=(std::int64_t const _k) {
+        m_value = this_class::wrap_units(
+            static_cast<std::int64_t>(static_cast<std::uint64_t>(m_value) *
+                                      static_cast<std::uint64_t>(_k)));
+        return *this;
+    }
+
+    this_class operator-() const {
+        return this_class::wrap(
+            this_class::wrap_units(-static_cast<std::int64_t>(m_value)));
+    }
+
+    this_class operator+(this_class const& _x) const {
+        return this_class(*this) += _x;
+    }
+
+    this_class operator-(this_class const& _x) const {
+        return this_class(*this) -= _x;
+    }
+
+    this_class operator*(std::int64_t const _k) const {
+        return this_class(*this) *= _k;
+    }
+
+    bool operator==(this_class const& _x) const {
+        return m_value == _x.m_value;
+    }
+
+    bool operator!=(this_class const& _x) const {
+        return m_value != _x.m_value;
+    }
+
+ private:
+    static storage_type wrap_units(std::int64_t const _units) {
+        std::uint64_t const mask = (std::uint64_t(1u) << bits) - 1u;
+
+        return static_cast<storage_type>(
+            static_cast<std::uint64_t>(_units) & mask);
+    }
+
+    /*!
+     \brief Converts the radians \f$|x| \leq \pi\f$ with _f fractional bits
+     to \f$\frac{1}{2^{bits}}\f$ turns rounded to the nearest.
+    */
+    static std::int64_t units_of(std::int64_t const _value, int const _f) {
+        // 2/pi is scaled by 2^64
+        static std::uint64_t const inverse = static_cast<std::uint64_t>(
+            std::ldexp(libq::details::pi_2_constant::inverse(), 64));
+
+        // |x| < 4 is scaled to 2^63
+        std::uint64_t const magnitude =
+            static_cast<std::uint64_t>((_value < 0) ? -_value : _value);
+        std::uint64_t const scaled = (_f <= 61) ?
+            magnitude << (61 - _f) : magnitude >> (_f - 61);
+
+        // quadrants with 61 fractional bits rounded to (bits - 2) ones
+        int const shift = 63 - static_cast<int>(bits);
+        std::uint64_t const units =
+            (libq::details::mulhi(scaled, inverse) +
+             (std::uint64_t(1u) << (shift - 1))) >> shift;
+
+        return (_value < 0) ? -static_cast<std::int64_t>(units) :
+                              static_cast<std::int64_t>(units);
+    }
+
+    storage_type m_value;
+};
+}  // namespace libq
+
+#endif  // INC_LIBQ_ANGLE_HPP_
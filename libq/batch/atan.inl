@@ -0,0 +1,136 @@
+// atan.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file atan.inl
+
+ Provides the batch atan function over the SIMD lanes
+*/
+
+#ifndef INC_LIBQ_BATCH_ATAN_INL_
+#define INC_LIBQ_BATCH_ATAN_INL_
+
+namespace libq {
+namespace details {
+/*!
+ \brief Prepares the CORDIC vectoring of libq::atan<f> for
+ libq::details::batch_transform: the vector (1, x) is rotated to the x-axis
+ and z accumulates the angle.
+*/
+template<typename Q>
+class batch_atan_kernel {
+    static_assert(Q::is_signed,
+                  "the CORDIC vectoring needs the signs of the work type");
+
+    using precision =
+        libq::details::precision_traits<Q::bits_for_fractional,
+                                        Q::bits_for_fractional>;
+
+ public:
+    using argument_type = Q;
+    using result_type = typename libq::details::atan_of<Q>::promoted_type;
+    using mode = libq::cordic::vectoring;
+    using coordinates = libq::cordic::circular;
+    using work_type = typename libq::details::atan_of<
+        libq::fixed_point<typename Q::storage_type,
+                          Q::bits_for_integral,
+                          precision::bits_for_fractional,
+                          Q::scaling_factor_exponent,
+                          typename Q::overflow_policy,
+                          typename Q::underflow_policy> >::promoted_type;
+    using lane_type = typename libq::details::lane_of<work_type>::type;
+    using tag_type = int;
+
+    enum: std::size_t {
+        iterations = precision::iterations
+    };
+
+    static tag_type prepare(argument_type const _val,
+                       lane_type& _x,
+                       lane_type& _y,
+                       lane_type& _z) {
+        _x = static_cast<lane_type>(work_type(1.0).value());
+        _y = static_cast<lane_type>(work_type(_val).value());
+        _z = static_cast<lane_type>(work_type(0.0).value());
+
+        return 0;
+    }
+
+    template<class ISA>
+    static void iterate(lane_type* _x,
+                        lane_type* _y,
+                        lane_type* _z,
+                        std::size_t const _count) {
+        libq::details::batch_engine<mode,
+                                    coordinates,
+                                    work_type,
+                                    iterations,
+                                    ISA>::apply(_x, _y, _z, _count);
+    }
+
+    static result_type finish(lane_type const,
+                              lane_type const,
+                              lane_type const _z,
+                              tag_type const) {
+        return result_type(work_type::wrap(
+            static_cast<typename work_type::storage_type>(_z)));
+    }
+};
+}  // namespace details
+
+
+namespace batch {
+/*!
+ \brief Computes the arctangents of the array:
+ _out[i] = libq::atan<f>(_in[i]) for \f$i = 0, 1, ..., n - 1\f$.
+ \tparam ISA instruction set of the CORDIC steps, see libq::isa: the
+ one of libq::isa::active() level by default
+ \details The CORDIC vectorings of the block run over the SIMD lanes, see
+ libq::details::batch_transform. The results are bit-exact with
+ libq::atan<libq::engine::cordic>.
+*/
+template<class ISA = libq::isa::dispatched,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void atan(libq::fixed_point<T, n, f, e, op, up> const* _in,
+          typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type* _out,  // NOLINT
+          std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_atan_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform<kernel_type, ISA>::apply(_in, _out, _n);
+}
+
+
+/*!
+ \brief Computes the arctangents of the array by the chunks run as the policy
+ says: libq::parallel::sequenced_policy or libq::parallel::parallel_policy.
+ \details Every chunk runs the kernel of ISA, see libq::parallel::transform.
+*/
+template<class ISA = libq::isa::dispatched,
+         class Policy,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void atan(Policy const& _policy,
+          libq::fixed_point<T, n, f, e, op, up> const* _in,
+          typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type* _out,  // NOLINT
+          std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_atan_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform_by<kernel_type, ISA>(_policy, _in, _out, _n);  // NOLINT
+}
+}  // namespace batch
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_ATAN_INL_
@@ -0,0 +1,116 @@
+// cos.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file cos.inl
+
+ Provides the batch cos function over the SIMD lanes
+*/
+
+#ifndef INC_LIBQ_BATCH_COS_INL_
+#define INC_LIBQ_BATCH_COS_INL_
+
+namespace libq {
+namespace details {
+/*!
+ \brief Selects the cosine of the argument by its quadrant like
+ libq::cos<f> does.
+*/
+template<typename Q>
+class batch_cos_kernel
+    : public libq::details::batch_sincos_kernel<Q> {
+    using base_class = libq::details::batch_sincos_kernel<Q>;
+
+ public:
+    using lane_type = typename base_class::lane_type;
+    using tag_type = typename base_class::tag_type;
+    using result_type = typename libq::details::cos_of<Q>::promoted_type;
+
+    static result_type finish(lane_type const _x,
+                              lane_type const _y,
+                              lane_type const,
+                              tag_type const _quadrant) {
+        auto const x = base_class::value_of(_x);
+        auto const y = base_class::value_of(_y);
+
+        switch (_quadrant) {
+        case 0:
+            return result_type(x);
+        case 1:
+            return result_type(-y);
+        case 2:
+            return result_type(-x);
+        default:
+            return result_type(y);
+        }
+    }
+};
+}  // namespace details
+
+
+namespace batch {
+/*!
+ \brief Computes the cosines of the array: _out[i] = libq::cos<f>(_in[i]) for
+ \f$i = 0, 1, ..., n - 1\f$.
+ \tparam ISA instruction set of the CORDIC steps, see libq::isa: the
+ one of libq::isa::active() level by default
+ \details The range reduction and the quadrant selection are the scalar ones,
+ the CORDIC rotations of the block run over the SIMD lanes, see
+ libq::details::batch_transform. The results are bit-exact with
+ libq::cos<libq::engine::cordic>.
+
+ <B>Usage</B>
+ \code{.cpp}
+    using Q = libq::Q<15, 12>;
+
+    std::vector<Q> angles(1024, Q(0.5));
+    std::vector<libq::Q<1, 12> > cosines(angles.size());
+
+    libq::batch::cos(angles.data(), cosines.data(), angles.size());
+ \endcode
+*/
+template<class ISA = libq::isa::dispatched,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void cos(libq::fixed_point<T, n, f, e, op, up> const* _in,
+         typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type* _out,  // NOLINT
+         std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_cos_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform<kernel_type, ISA>::apply(_in, _out, _n);
+}
+
+
+/*!
+ \brief Computes the cosines of the array by the chunks run as the policy
+ says: libq::parallel::sequenced_policy or libq::parallel::parallel_policy.
+ \details Every chunk runs the kernel of ISA, see libq::parallel::transform.
+*/
+template<class ISA = libq::isa::dispatched,
+         class Policy,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void cos(Policy const& _policy,
+         libq::fixed_point<T, n, f, e, op, up> const* _in,
+         typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type* _out,  // NOLINT
+         std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_cos_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform_by<kernel_type, ISA>(_policy, _in, _out, _n);  // NOLINT
+}
+}  // namespace batch
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_COS_INL_
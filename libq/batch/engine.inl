@@ -0,0 +1,244 @@
+// engine.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file engine.inl
+
+ Provides the CORDIC engine running over the SIMD lanes and the driver of the
+ batch functions of libq/batch.
+*/
+
+#ifndef INC_LIBQ_BATCH_ENGINE_INL_
+#define INC_LIBQ_BATCH_ENGINE_INL_
+
+#include <cstdint>
+#include <type_traits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Runs the steps of libq::cordic::engine over the lanes of the
+ instruction set ISA.
+ \details The states (x, y, z) are kept by the arrays of the stored integers
+ of Q. The direction of the step is the sign mask of the lane, so
+ \f$d_i 2^{-s_i} y\f$ is the conditional negation of the shifted y and the
+ angle \f$e_i\f$ of libq::cordic::lut is broadcast to all the lanes. The
+ steps are the integer operations of the scalar engine, so the results are
+ bit-exact. The direction is found in place: the registers returned by the
+ functions out of libq::details::lanes would be passed by the ABI of the
+ narrower instruction set.
+*/
+template<class Mode,
+         class Coordinates,
+         typename Q,
+         std::size_t iterations,
+         class ISA>
+class batch_engine {
+    using traits = libq::cordic::coordinates_traits<Coordinates, Q, iterations>;  // NOLINT
+    using lut_type = libq::cordic::lut<iterations, Q>;
+
+ public:
+    using lane_type = typename libq::details::lane_of<Q>::type;
+    using lanes_type = libq::details::lanes<lane_type, ISA>;
+
+    enum: std::size_t {
+        size = lanes_type::size  ///< states per register
+    };
+
+    /*!
+     \brief Runs all the steps for the states _x[i], _y[i], _z[i].
+     \param _count number of the states, the multiple of size
+    */
+    static void apply(lane_type* _x,
+                      lane_type* _y,
+                      lane_type* _z,
+                      std::size_t const _count) {
+        using register_type = typename lanes_type::register_type;
+
+        bool const is_rotation =
+            std::is_same<Mode, libq::cordic::rotation>::value;
+
+        static lut_type const angles = traits::angles();
+
+        for (std::size_t j = 0u; j < _count; j += size) {
+            register_type x = lanes_type::load(_x + j);
+            register_type y = lanes_type::load(_y + j);
+            register_type z = lanes_type::load(_z + j);
+
+            for (std::size_t i = 0u; i != iterations; ++i) {
+                std::size_t const shift = traits::shift(i);
+                std::size_t const repeats =
+                    traits::is_repeated(shift) ? 2u : 1u;
+                register_type const angle = lanes_type::broadcast(
+                    static_cast<lane_type>(angles[i].value()));
+
+                for (std::size_t k = 0u; k != repeats; ++k) {
+                    // d_i = -1 if z < 0 for the rotation and if x and y
+                    // have the same sign for the vectoring, see
+                    // libq::cordic::mode_traits
+                    register_type const negative = is_rotation ?
+                        lanes_type::sign(z) :
+                        lanes_type::bitwise_not(lanes_type::bitwise_xor(
+                            lanes_type::sign(x), lanes_type::sign(y)));
+                    register_type const x_shifted = lanes_type::negate_if(
+                        lanes_type::shift_right(x, static_cast<int>(shift)),
+                        negative);
+                    register_type const y_shifted = lanes_type::negate_if(
+                        lanes_type::shift_right(y, static_cast<int>(shift)),
+                        negative);
+
+                    if (traits::m > 0) {
+                        x = lanes_type::sub(x, y_shifted);
+                    } else if (traits::m < 0) {
+                        x = lanes_type::add(x, y_shifted);
+                    }
+                    y = lanes_type::add(y, x_shifted);
+                    z = lanes_type::sub(z,
+                                        lanes_type::negate_if(angle, negative));  // NOLINT
+                }
+            }
+
+            lanes_type::store(_x + j, x);
+            lanes_type::store(_y + j, y);
+            lanes_type::store(_z + j, z);
+        }
+    }
+};
+
+
+/*!
+ \brief Applies the function given by Kernel to the array by the lanes of
+ ISA.
+ \details The array is processed by blocks of 64 numbers:
+ Kernel::prepare reduces the arguments to the initial states (x, y, z) of
+ the lanes, Kernel::iterate runs the steps over the lanes and
+ Kernel::finish converts the final states to the results. The last block is
+ padded by zero states, so the tail elements need no scalar loop.
+
+ Kernel provides argument_type, result_type, lane_type and tag_type and
+ \code
+    static tag_type prepare(argument_type x, lane_type& x, lane_type& y, lane_type& z);  // NOLINT
+
+    template<class ISA>
+    static void iterate(lane_type* x, lane_type* y, lane_type* z, std::size_t count);  // NOLINT
+
+    static result_type finish(lane_type x, lane_type y, lane_type z, tag_type tag);  // NOLINT
+ \endcode
+ where the tag passes the quadrant, the binary exponent or the like from
+ prepare to finish and the count is the multiple of
+ libq::details::lanes<lane_type, ISA>::size.
+*/
+template<class Kernel, class ISA>
+class batch_loop {
+    using lane_type = typename Kernel::lane_type;
+    using tag_type = typename Kernel::tag_type;
+    using lanes_type = libq::details::lanes<lane_type, ISA>;
+
+    enum: std::size_t {
+        block = 64u
+    };
+
+    static_assert(block % lanes_type::size == 0u,
+                  "the block must keep whole registers");
+
+ public:
+    using argument_type = typename Kernel::argument_type;
+    using result_type = typename Kernel::result_type;
+
+    static void apply(argument_type const* _in,
+                      result_type* _out,
+                      std::size_t const _n) {
+        lane_type x[block], y[block], z[block];
+        tag_type tag[block];
+
+        for (std::size_t first = 0u; first < _n; first += block) {
+            std::size_t const count =
+                (_n - first < block) ? _n - first : std::size_t(block);
+            std::size_t const padded =
+                (count + lanes_type::size - 1u) / lanes_type::size *
+                lanes_type::size;
+
+            for (std::size_t i = 0u; i != count; ++i) {
+                tag[i] = Kernel::prepare(_in[first + i], x[i], y[i], z[i]);
+            }
+            for (std::size_t i = count; i != padded; ++i) {
+                x[i] = y[i] = z[i] = 0;
+            }
+
+            Kernel::template iterate<ISA>(x, y, z, padded);
+
+            for (std::size_t i = 0u; i != count; ++i) {
+                _out[first + i] = Kernel::finish(x[i], y[i], z[i], tag[i]);
+            }
+        }
+    }
+};
+
+
+/*!
+ \brief Runs libq::details::batch_loop compiled for ISA, see
+ libq::details::isa_entry.
+*/
+template<class Kernel, class ISA>
+class batch_transform {
+ public:
+    using argument_type = typename Kernel::argument_type;
+    using result_type = typename Kernel::result_type;
+
+    static void apply(argument_type const* _in,
+                      result_type* _out,
+                      std::size_t const _n) {
+        libq::details::isa_entry<ISA>::template run<
+            libq::details::batch_loop<Kernel, ISA> >(_in, _out, _n);
+    }
+};
+
+
+/*!
+ \brief Runs libq::details::batch_loop of the libq::isa::active() level.
+*/
+template<class Kernel>
+class batch_transform<Kernel, libq::isa::dispatched> {
+    template<class ISA>
+    using loop_type = libq::details::batch_loop<Kernel, ISA>;
+
+ public:
+    using argument_type = typename Kernel::argument_type;
+    using result_type = typename Kernel::result_type;
+
+    static void apply(argument_type const* _in,
+                      result_type* _out,
+                      std::size_t const _n) {
+        libq::details::dispatch<loop_type>(_in, _out, _n);
+    }
+};
+
+
+/*!
+ \brief Runs libq::details::batch_transform over the chunks of the array
+ given by the policy, see libq::parallel::details::for_each_chunk.
+ \details The chunks are the multiples of the block, so only the last one
+ has the padded tail.
+*/
+template<class Kernel, class ISA, class Policy>
+void batch_transform_by(Policy const& _policy,
+                        typename Kernel::argument_type const* _in,
+                        typename Kernel::result_type* _out,
+                        std::size_t const _n) {
+    libq::parallel::details::for_each_chunk(
+        _policy,
+        _n,
+        sizeof(typename Kernel::argument_type) +
+            sizeof(typename Kernel::result_type),
+        64u,
+        [_in, _out](std::size_t const _first, std::size_t const _last) {
+            libq::details::batch_transform<Kernel, ISA>::apply(
+                _in + _first, _out + _first, _last - _first);
+        });
+}
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_ENGINE_INL_
@@ -0,0 +1,176 @@
+// exp.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file exp.inl
+
+ Provides the batch exp function over the SIMD lanes
+*/
+
+#ifndef INC_LIBQ_BATCH_EXP_INL_
+#define INC_LIBQ_BATCH_EXP_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Runs the shift-and-add steps of libq::exp<f> over the lanes.
+ \details The state of the lane is \f$e^r\f$ with 62 fractional bits (x)
+ and the rest of r (y), the tag is the binary exponent k. The step
+ \f$r \geq \ln(1 + 2^{-i})\f$ is the mask of the comparison, so the
+ subtraction and the shift-and-add are masked. The logarithm of the step is
+ the same for all the lanes, it is broadcast.
+*/
+template<typename Q>
+class batch_exp_kernel {
+    using precision =
+        libq::details::precision_traits<Q::bits_for_fractional,
+                                        Q::bits_for_fractional>;
+    using work_type = libq::Q<precision::bits_for_fractional + 1u,
+                              precision::bits_for_fractional,
+                              0,
+                              typename Q::overflow_policy,
+                              typename Q::underflow_policy>;
+
+    enum: std::size_t {
+        steps = precision::iterations / 2u + 1u
+    };
+    using lut_type = libq::cordic::lut<steps, work_type>;
+
+ public:
+    using argument_type = Q;
+    using result_type = typename libq::details::exp_of<Q>::promoted_type;
+    using lane_type = std::int64_t;
+    using tag_type = std::int64_t;
+
+    static tag_type prepare(argument_type const _val,
+                            lane_type& _y,
+                            lane_type& _r,
+                            lane_type& _unused) {
+        static libq::details::scaled_constant<libq::details::ln2_constant,
+                                              work_type::bits_for_fractional> const ln2;  // NOLINT
+
+        work_type arg(0);
+        std::int64_t k =
+            libq::details::reduce<libq::details::ln2_constant>(_val, arg);
+        std::int64_t r = static_cast<std::int64_t>(arg.value());
+        if (r < 0) {
+            r += ln2.hi;
+            --k;
+        }
+
+        _y = std::int64_t(1) << 62;
+        _r = r;
+        _unused = 0;
+
+        return k;
+    }
+
+    template<class ISA>
+    static void iterate(lane_type* _y,
+                        lane_type* _r,
+                        lane_type*,
+                        std::size_t const _count) {
+        using lanes_type = libq::details::lanes<lane_type, ISA>;
+        using register_type = typename lanes_type::register_type;
+
+        static lut_type const logs = lut_type::log_one_plus();
+
+        for (std::size_t j = 0u; j < _count; j += lanes_type::size) {
+            register_type y = lanes_type::load(_y + j);
+            register_type r = lanes_type::load(_r + j);
+
+            for (std::size_t i = 0u; i != steps; ++i) {
+                register_type const l = lanes_type::broadcast(
+                    static_cast<lane_type>(logs[i].value()));
+                register_type const taken =
+                    lanes_type::bitwise_not(lanes_type::greater(l, r));
+
+                r = lanes_type::sub(r, lanes_type::bitwise_and(l, taken));
+                y = lanes_type::add(y, lanes_type::bitwise_and(
+                    lanes_type::shift_right_logical(y, static_cast<int>(i) + 1),  // NOLINT
+                    taken));
+            }
+
+            lanes_type::store(_y + j, y);
+            lanes_type::store(_r + j, r);
+        }
+    }
+
+    static result_type finish(lane_type const _y,
+                              lane_type const _r,
+                              lane_type const,
+                              tag_type const _k) {
+        enum: int {
+            fractional = static_cast<int>(work_type::bits_for_fractional)
+        };
+
+        // e^r = 1 + r for the residual, see libq::exp<f>
+        std::uint64_t y = static_cast<std::uint64_t>(_y);
+        y += libq::details::mulhi(y, static_cast<std::uint64_t>(_r) <<
+                                         (64 - fractional));
+
+        return libq::details::scale_by_power_of_two<result_type>(y, _k);
+    }
+};
+}  // namespace details
+
+
+namespace batch {
+/*!
+ \brief Computes the exponents of the array: _out[i] = libq::exp<f>(_in[i])
+ for \f$i = 0, 1, ..., n - 1\f$.
+ \tparam ISA instruction set of the shift-and-add steps, see libq::isa: the
+ one of libq::isa::active() level by default
+ \details The range reduction and the final scaling are the scalar ones, the
+ steps of the block run over the 64-bit SIMD lanes, see
+ libq::details::batch_exp_kernel. The results are bit-identical to the ones
+ of libq::exp<libq::engine::cordic>, the overflow is raised and saturated
+ the same way.
+*/
+template<class ISA = libq::isa::dispatched,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void exp(libq::fixed_point<T, n, f, e, op, up> const* _in,
+         typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type* _out,  // NOLINT
+         std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_exp_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform<kernel_type, ISA>::apply(_in, _out, _n);
+}
+
+
+/*!
+ \brief Computes the exponents of the array by the chunks run as the policy
+ says: libq::parallel::sequenced_policy or libq::parallel::parallel_policy.
+ \details Every chunk runs the kernel of ISA, see libq::parallel::transform.
+*/
+template<class ISA = libq::isa::dispatched,
+         class Policy,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void exp(Policy const& _policy,
+         libq::fixed_point<T, n, f, e, op, up> const* _in,
+         typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type* _out,  // NOLINT
+         std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_exp_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform_by<kernel_type, ISA>(_policy, _in, _out, _n);  // NOLINT
+}
+}  // namespace batch
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_EXP_INL_
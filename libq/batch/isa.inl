@@ -0,0 +1,350 @@
+// isa.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file isa.inl
+
+ Provides the instruction sets the batch kernels of libq/batch are compiled
+ for and the choice of the one the host supports at run time.
+*/
+
+#ifndef INC_LIBQ_BATCH_ISA_INL_
+#define INC_LIBQ_BATCH_ISA_INL_
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+/*!
+ \brief GCC and Clang compile the kernels of every instruction set by the
+ target attributes, so the binary built for the baseline x86 runs the widest
+ kernels the host supports. The other compilers get the kernels enabled by
+ their options only.
+*/
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define LIBQ_TARGET_SSE4_2 __attribute__((target("sse4.2")))
+#define LIBQ_TARGET_AVX2 __attribute__((target("avx2")))
+#define LIBQ_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#define LIBQ_FLATTEN __attribute__((flatten))
+
+#define LIBQ_HAS_SSE4_2
+#define LIBQ_HAS_AVX2
+#define LIBQ_HAS_AVX512
+#define LIBQ_HAS_CPUID
+#else
+#if defined(__SSE4_2__) || defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#define LIBQ_TARGET_SSE4_2
+#define LIBQ_TARGET_AVX2
+#define LIBQ_TARGET_AVX512
+#define LIBQ_FLATTEN
+
+#if defined(__SSE4_2__)
+#define LIBQ_HAS_SSE4_2
+#endif
+#if defined(__AVX2__)
+#define LIBQ_HAS_AVX2
+#endif
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#define LIBQ_HAS_AVX512
+#endif
+#endif
+
+namespace libq {
+/*!
+ \brief Tags of the instruction sets the batch kernels are compiled for.
+ \details libq::isa::dispatched, the default one of the batch functions,
+ runs the kernel of libq::isa::active() level. The other tags choose the
+ kernel at compile time: the caller must check the host supports it.
+
+ <B>Usage</B>
+ \code{.cpp}
+    // the widest kernels the host supports, or the ones of LIBQ_ISA
+    libq::batch::sin(angles.data(), sines.data(), angles.size());
+
+    // compares the kernels of two levels in one binary
+    libq::isa::force(libq::isa::level::sse4_2);
+    libq::batch::sin(angles.data(), sse_sines.data(), angles.size());
+    libq::isa::force(libq::isa::supported());
+ \endcode
+*/
+namespace isa {
+/*!
+ \brief One lane: the plain integer arithmetics.
+*/
+class scalar {
+};
+
+/*!
+ \brief 128-bit registers: 8, 4 or 2 lanes of 16, 32 or 64 bits.
+*/
+class sse4_2 {
+};
+
+/*!
+ \brief 256-bit registers: 16, 8 or 4 lanes of 16, 32 or 64 bits.
+*/
+class avx2 {
+};
+
+/*!
+ \brief 512-bit registers of AVX-512F and AVX-512BW: 32, 16 or 8 lanes of
+ 16, 32 or 64 bits.
+*/
+class avx512 {
+};
+
+/*!
+ \brief The instruction set chosen at run time, see libq::isa::active().
+*/
+class dispatched {
+};
+
+/*!
+ \brief The widest instruction set enabled by the compiler options.
+*/
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+using native = libq::isa::avx512;
+#elif defined(__AVX2__)
+using native = libq::isa::avx2;
+#elif defined(__SSE4_2__)
+using native = libq::isa::sse4_2;
+#else
+using native = libq::isa::scalar;
+#endif
+
+
+/*!
+ \brief Levels of the instruction sets in the ascending order.
+*/
+enum class level: int {
+    scalar = 0,
+    sse4_2 = 1,
+    avx2 = 2,
+    avx512 = 3
+};
+
+
+namespace details {
+/*!
+ \brief Gets the widest level compiled in and supported by the host.
+ \details The host is asked by CPUID. AVX2 and AVX-512 need the operating
+ system to save the wide registers as well, see XGETBV.
+*/
+inline libq::isa::level detect() {
+#if defined(LIBQ_HAS_CPUID)
+    unsigned int eax(0u), ebx(0u), ecx(0u), edx(0u);
+    if (!__get_cpuid(1u, &eax, &ebx, &ecx, &edx)) {
+        return libq::isa::level::scalar;
+    }
+
+    bool const sse4_2 = (ecx & (1u << 20)) != 0u;
+    bool const osxsave = (ecx & (1u << 27)) != 0u;
+    bool const avx = (ecx & (1u << 28)) != 0u;
+
+    // XCR0: SSE and AVX states (bits 1, 2), AVX-512 states (bits 5, 6, 7)
+    unsigned int xcr0(0u);
+    if (osxsave) {
+        unsigned int high(0u);
+        __asm__("xgetbv" : "=a"(xcr0), "=d"(high) : "c"(0u));
+    }
+    bool const ymm = osxsave && avx && ((xcr0 & 0x06u) == 0x06u);
+    bool const zmm = ymm && ((xcr0 & 0xE0u) == 0xE0u);
+
+    bool avx2(false), avx512(false);
+    if (__get_cpuid_max(0u, nullptr) >= 7u) {
+        __cpuid_count(7u, 0u, eax, ebx, ecx, edx);
+        avx2 = ymm && (ebx & (1u << 5)) != 0u;
+        avx512 = zmm && (ebx & (1u << 16)) != 0u && (ebx & (1u << 30)) != 0u;
+    }
+
+    return avx512 ? libq::isa::level::avx512 :
+           avx2 ? libq::isa::level::avx2 :
+           sse4_2 ? libq::isa::level::sse4_2 :
+                    libq::isa::level::scalar;
+#elif defined(LIBQ_HAS_AVX512)
+    return libq::isa::level::avx512;
+#elif defined(LIBQ_HAS_AVX2)
+    return libq::isa::level::avx2;
+#elif defined(LIBQ_HAS_SSE4_2)
+    return libq::isa::level::sse4_2;
+#else
+    return libq::isa::level::scalar;
+#endif
+}
+
+
+/*!
+ \brief Gets the level named by the environment variable LIBQ_ISA: scalar,
+ sse4.2, avx2 or avx512. The unknown names give _otherwise.
+*/
+inline libq::isa::level requested(libq::isa::level const _otherwise) {
+    char const* const name = std::getenv("LIBQ_ISA");
+    if (name == nullptr) {
+        return _otherwise;
+    }
+
+    if (std::strcmp(name, "scalar") == 0) {
+        return libq::isa::level::scalar;
+    } else if (std::strcmp(name, "sse4.2") == 0) {
+        return libq::isa::level::sse4_2;
+    } else if (std::strcmp(name, "avx2") == 0) {
+        return libq::isa::level::avx2;
+    } else if (std::strcmp(name, "avx512") == 0) {
+        return libq::isa::level::avx512;
+    }
+
+    return _otherwise;
+}
+
+
+inline libq::isa::level narrowest(libq::isa::level const _a,
+                                  libq::isa::level const _b) {
+    return (static_cast<int>(_a) < static_cast<int>(_b)) ? _a : _b;
+}
+
+
+/*!
+ \brief Keeps the active level: it is found once, by the first batch
+ function called.
+*/
+inline std::atomic<int>& active_level() {
+    static std::atomic<int> level(static_cast<int>(
+        libq::isa::details::narrowest(
+            libq::isa::details::requested(libq::isa::details::detect()),
+            libq::isa::details::detect())));
+
+    return level;
+}
+}  // namespace details
+
+
+/*!
+ \brief Gets the widest level the host supports among the compiled ones.
+*/
+inline libq::isa::level supported() {
+    static libq::isa::level const result = libq::isa::details::detect();
+
+    return result;
+}
+
+/*!
+ \brief Gets the level of the kernels libq::isa::dispatched runs.
+ \details It is the supported() one unless the environment variable
+ LIBQ_ISA or force() narrows it.
+*/
+inline libq::isa::level active() {
+    return static_cast<libq::isa::level>(
+        libq::isa::details::active_level().load(std::memory_order_relaxed));
+}
+
+/*!
+ \brief Makes libq::isa::dispatched run the kernels of the level, for
+ example to test the narrower kernels on the wide host.
+ \return the level set: the one the host supports at most
+*/
+inline libq::isa::level force(libq::isa::level const _level) {
+    libq::isa::level const result =
+        libq::isa::details::narrowest(_level, libq::isa::supported());
+    libq::isa::details::active_level().store(static_cast<int>(result),
+                                             std::memory_order_relaxed);
+
+    return result;
+}
+}  // namespace isa
+
+
+namespace details {
+/*!
+ \brief Runs F::apply compiled for the instruction set ISA.
+ \details The target attribute enables the instruction set for the entry
+ and flatten inlines all the calls into it, so the kernel and the lanes are
+ compiled for ISA even if the rest of the binary is not.
+*/
+template<class ISA>
+class isa_entry;
+
+
+template<>
+class isa_entry<libq::isa::scalar> {
+ public:
+    template<class F, typename... Args>
+    static void run(Args... _args) {
+        F::apply(_args...);
+    }
+};
+
+
+#if defined(LIBQ_HAS_SSE4_2)
+template<>
+class isa_entry<libq::isa::sse4_2> {
+ public:
+    template<class F, typename... Args>
+    LIBQ_TARGET_SSE4_2 LIBQ_FLATTEN static void run(Args... _args) {
+        F::apply(_args...);
+    }
+};
+#endif
+
+
+#if defined(LIBQ_HAS_AVX2)
+template<>
+class isa_entry<libq::isa::avx2> {
+ public:
+    template<class F, typename... Args>
+    LIBQ_TARGET_AVX2 LIBQ_FLATTEN static void run(Args... _args) {
+        F::apply(_args...);
+    }
+};
+#endif
+
+
+#if defined(LIBQ_HAS_AVX512)
+template<>
+class isa_entry<libq::isa::avx512> {
+ public:
+    template<class F, typename... Args>
+    LIBQ_TARGET_AVX512 LIBQ_FLATTEN static void run(Args... _args) {
+        F::apply(_args...);
+    }
+};
+#endif
+
+
+/*!
+ \brief Runs F<ISA>::apply for the ISA of the libq::isa::active() level.
+*/
+template<template<class> class F, typename... Args>
+void dispatch(Args... _args) {
+    switch (libq::isa::active()) {
+#if defined(LIBQ_HAS_AVX512)
+    case libq::isa::level::avx512:
+        libq::details::isa_entry<libq::isa::avx512>::template run<F<libq::isa::avx512> >(_args...);  // NOLINT
+        break;
+#endif
+#if defined(LIBQ_HAS_AVX2)
+    case libq::isa::level::avx2:
+        libq::details::isa_entry<libq::isa::avx2>::template run<F<libq::isa::avx2> >(_args...);  // NOLINT
+        break;
+#endif
+#if defined(LIBQ_HAS_SSE4_2)
+    case libq::isa::level::sse4_2:
+        libq::details::isa_entry<libq::isa::sse4_2>::template run<F<libq::isa::sse4_2> >(_args...);  // NOLINT
+        break;
+#endif
+    default:
+        libq::details::isa_entry<libq::isa::scalar>::template run<F<libq::isa::scalar> >(_args...);  // NOLINT
+        break;
+    }
+}
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_ISA_INL_
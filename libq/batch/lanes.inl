@@ -0,0 +1,755 @@
+// lanes.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file lanes.inl
+
+ Provides the integer SIMD lanes the batch kernels of libq/batch are built
+ on: the scalar ones and SSE4.2, AVX2 and AVX-512 registers of 16-bit,
+ 32-bit and 64-bit integers.
+*/
+
+#ifndef INC_LIBQ_BATCH_LANES_INL_
+#define INC_LIBQ_BATCH_LANES_INL_
+
+#include <cstdint>
+#include <type_traits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the type of the lane that keeps the stored integer of Q: the
+ signed integer of the same width, so the lanes wrap around like the scalar
+ code does. The 8-bit integers are kept by the 16-bit lanes.
+*/
+template<typename Q>
+class lane_of {
+    using storage_type = typename Q::storage_type;
+
+ public:
+    using type = typename std::conditional<
+        sizeof(storage_type) <= sizeof(std::int16_t),
+        std::int16_t,
+        typename std::conditional<sizeof(storage_type) <= sizeof(std::int32_t),  // NOLINT
+                                  std::int32_t,
+                                  std::int64_t>::type>::type;
+};
+
+
+/*!
+ \brief Keeps size lanes of the signed integer T in the register of the
+ instruction set ISA: 16-bit, 32-bit or 64-bit integers.
+ \details All the operations wrap around like the integer arithmetics of the
+ scalar code does. The sign mask of the lane is all ones for the negative
+ integer and zero otherwise, so the conditional negation
+ \f$(v \oplus mask) - mask\f$ chooses the direction of the CORDIC step
+ without branches. The comparison greater gives the same masks, so the
+ conditional steps of the shift-and-add algorithms are the masked additions.
+
+ The operations of the SIMD lanes carry the target attributes of their
+ instruction sets, see libq::details::isa_entry.
+*/
+template<typename T, class ISA>
+class lanes;
+
+
+template<typename T>
+class lanes<T, libq::isa::scalar> {
+ public:
+    using register_type = T;
+
+    enum: std::size_t { size = 1u };
+
+    static register_type load(T const* _p) { return *_p; }
+    static void store(T* _p, register_type const _v) { *_p = _v; }
+    static register_type broadcast(T const _x) { return _x; }
+
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return static_cast<T>(_a + _b);
+    }
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return static_cast<T>(_a - _b);
+    }
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return static_cast<T>(_a ^ _b);
+    }
+    static register_type bitwise_not(register_type const _a) {
+        return static_cast<T>(~_a);
+    }
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return static_cast<T>(_a & _b);
+    }
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return (_a > _b) ? T(-1) : T(0);
+    }
+
+    static register_type shift_right(register_type const _v, int const _s) {
+        return static_cast<T>(_v >> _s);
+    }
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        using unsigned_type = typename std::make_unsigned<T>::type;
+
+        return static_cast<T>(static_cast<unsigned_type>(_v) >> _s);
+    }
+    static register_type sign(register_type const _v) {
+        return (_v < 0) ? T(-1) : T(0);
+    }
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return static_cast<T>((_v ^ _mask) - _mask);
+    }
+};
+
+
+#if defined(LIBQ_HAS_SSE4_2)
+template<>
+class lanes<std::int16_t, libq::isa::sse4_2> {
+ public:
+    using register_type = __m128i;
+
+    enum: std::size_t { size = 8u };
+
+    LIBQ_TARGET_SSE4_2
+    static register_type load(std::int16_t const* _p) {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(_p));
+    }
+    LIBQ_TARGET_SSE4_2
+    static void store(std::int16_t* _p, register_type const _v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(_p), _v);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type broadcast(std::int16_t const _x) {
+        return _mm_set1_epi16(_x);
+    }
+
+    LIBQ_TARGET_SSE4_2
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm_add_epi16(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm_sub_epi16(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return _mm_xor_si128(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type bitwise_not(register_type const _a) {
+        return _mm_xor_si128(_a, _mm_set1_epi16(-1));
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return _mm_and_si128(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return _mm_cmpgt_epi16(_a, _b);
+    }
+
+    LIBQ_TARGET_SSE4_2
+    static register_type shift_right(register_type const _v, int const _s) {
+        return _mm_sra_epi16(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        return _mm_srl_epi16(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type sign(register_type const _v) {
+        return _mm_srai_epi16(_v, 15);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return _mm_sub_epi16(_mm_xor_si128(_v, _mask), _mask);
+    }
+};
+
+
+template<>
+class lanes<std::int32_t, libq::isa::sse4_2> {
+ public:
+    using register_type = __m128i;
+
+    enum: std::size_t { size = 4u };
+
+    LIBQ_TARGET_SSE4_2
+    static register_type load(std::int32_t const* _p) {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(_p));
+    }
+    LIBQ_TARGET_SSE4_2
+    static void store(std::int32_t* _p, register_type const _v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(_p), _v);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type broadcast(std::int32_t const _x) {
+        return _mm_set1_epi32(_x);
+    }
+
+    LIBQ_TARGET_SSE4_2
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm_add_epi32(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm_sub_epi32(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return _mm_xor_si128(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type bitwise_not(register_type const _a) {
+        return _mm_xor_si128(_a, _mm_set1_epi32(-1));
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return _mm_and_si128(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return _mm_cmpgt_epi32(_a, _b);
+    }
+
+    LIBQ_TARGET_SSE4_2
+    static register_type shift_right(register_type const _v, int const _s) {
+        return _mm_sra_epi32(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        return _mm_srl_epi32(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type sign(register_type const _v) {
+        return _mm_srai_epi32(_v, 31);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return _mm_sub_epi32(_mm_xor_si128(_v, _mask), _mask);
+    }
+};
+
+
+template<>
+class lanes<std::int64_t, libq::isa::sse4_2> {
+ public:
+    using register_type = __m128i;
+
+    enum: std::size_t { size = 2u };
+
+    LIBQ_TARGET_SSE4_2
+    static register_type load(std::int64_t const* _p) {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(_p));
+    }
+    LIBQ_TARGET_SSE4_2
+    static void store(std::int64_t* _p, register_type const _v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(_p), _v);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type broadcast(std::int64_t const _x) {
+        return _mm_set1_epi64x(_x);
+    }
+
+    LIBQ_TARGET_SSE4_2
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm_add_epi64(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm_sub_epi64(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return _mm_xor_si128(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type bitwise_not(register_type const _a) {
+        return _mm_xor_si128(_a, _mm_set1_epi64x(-1));
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return _mm_and_si128(_a, _b);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return _mm_cmpgt_epi64(_a, _b);
+    }
+
+    /*!
+     \brief There is no arithmetic shift of 64-bit lanes before AVX-512: the
+     logical shift of \f$v \oplus sign\f$ restores the sign bits.
+    */
+    LIBQ_TARGET_SSE4_2
+    static register_type shift_right(register_type const _v, int const _s) {
+        register_type const s = lanes::sign(_v);
+
+        return _mm_xor_si128(
+            _mm_srl_epi64(_mm_xor_si128(_v, s), _mm_cvtsi32_si128(_s)), s);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        return _mm_srl_epi64(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type sign(register_type const _v) {
+        return _mm_cmpgt_epi64(_mm_setzero_si128(), _v);
+    }
+    LIBQ_TARGET_SSE4_2
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return _mm_sub_epi64(_mm_xor_si128(_v, _mask), _mask);
+    }
+};
+#endif
+
+
+#if defined(LIBQ_HAS_AVX2)
+template<>
+class lanes<std::int16_t, libq::isa::avx2> {
+ public:
+    using register_type = __m256i;
+
+    enum: std::size_t { size = 16u };
+
+    LIBQ_TARGET_AVX2
+    static register_type load(std::int16_t const* _p) {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(_p));
+    }
+    LIBQ_TARGET_AVX2
+    static void store(std::int16_t* _p, register_type const _v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_p), _v);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type broadcast(std::int16_t const _x) {
+        return _mm256_set1_epi16(_x);
+    }
+
+    LIBQ_TARGET_AVX2
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm256_add_epi16(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm256_sub_epi16(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return _mm256_xor_si256(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type bitwise_not(register_type const _a) {
+        return _mm256_xor_si256(_a, _mm256_set1_epi16(-1));
+    }
+    LIBQ_TARGET_AVX2
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return _mm256_and_si256(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return _mm256_cmpgt_epi16(_a, _b);
+    }
+
+    LIBQ_TARGET_AVX2
+    static register_type shift_right(register_type const _v, int const _s) {
+        return _mm256_sra_epi16(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX2
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        return _mm256_srl_epi16(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX2
+    static register_type sign(register_type const _v) {
+        return _mm256_srai_epi16(_v, 15);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return _mm256_sub_epi16(_mm256_xor_si256(_v, _mask), _mask);
+    }
+};
+
+
+template<>
+class lanes<std::int32_t, libq::isa::avx2> {
+ public:
+    using register_type = __m256i;
+
+    enum: std::size_t { size = 8u };
+
+    LIBQ_TARGET_AVX2
+    static register_type load(std::int32_t const* _p) {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(_p));
+    }
+    LIBQ_TARGET_AVX2
+    static void store(std::int32_t* _p, register_type const _v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_p), _v);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type broadcast(std::int32_t const _x) {
+        return _mm256_set1_epi32(_x);
+    }
+
+    LIBQ_TARGET_AVX2
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm256_add_epi32(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm256_sub_epi32(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return _mm256_xor_si256(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type bitwise_not(register_type const _a) {
+        return _mm256_xor_si256(_a, _mm256_set1_epi32(-1));
+    }
+    LIBQ_TARGET_AVX2
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return _mm256_and_si256(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return _mm256_cmpgt_epi32(_a, _b);
+    }
+
+    LIBQ_TARGET_AVX2
+    static register_type shift_right(register_type const _v, int const _s) {
+        return _mm256_sra_epi32(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX2
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        return _mm256_srl_epi32(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX2
+    static register_type sign(register_type const _v) {
+        return _mm256_srai_epi32(_v, 31);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return _mm256_sub_epi32(_mm256_xor_si256(_v, _mask), _mask);
+    }
+};
+
+
+template<>
+class lanes<std::int64_t, libq::isa::avx2> {
+ public:
+    using register_type = __m256i;
+
+    enum: std::size_t { size = 4u };
+
+    LIBQ_TARGET_AVX2
+    static register_type load(std::int64_t const* _p) {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(_p));
+    }
+    LIBQ_TARGET_AVX2
+    static void store(std::int64_t* _p, register_type const _v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_p), _v);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type broadcast(std::int64_t const _x) {
+        return _mm256_set1_epi64x(_x);
+    }
+
+    LIBQ_TARGET_AVX2
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm256_add_epi64(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm256_sub_epi64(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return _mm256_xor_si256(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type bitwise_not(register_type const _a) {
+        return _mm256_xor_si256(_a, _mm256_set1_epi64x(-1));
+    }
+    LIBQ_TARGET_AVX2
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return _mm256_and_si256(_a, _b);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return _mm256_cmpgt_epi64(_a, _b);
+    }
+
+    /*!
+     \brief See lanes<std::int64_t, libq::isa::sse4_2>::shift_right.
+    */
+    LIBQ_TARGET_AVX2
+    static register_type shift_right(register_type const _v, int const _s) {
+        register_type const s = lanes::sign(_v);
+
+        return _mm256_xor_si256(
+            _mm256_srl_epi64(_mm256_xor_si256(_v, s), _mm_cvtsi32_si128(_s)),
+            s);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        return _mm256_srl_epi64(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX2
+    static register_type sign(register_type const _v) {
+        return _mm256_cmpgt_epi64(_mm256_setzero_si256(), _v);
+    }
+    LIBQ_TARGET_AVX2
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return _mm256_sub_epi64(_mm256_xor_si256(_v, _mask), _mask);
+    }
+};
+#endif
+
+
+#if defined(LIBQ_HAS_AVX512)
+template<>
+class lanes<std::int16_t, libq::isa::avx512> {
+ public:
+    using register_type = __m512i;
+
+    enum: std::size_t { size = 32u };
+
+    LIBQ_TARGET_AVX512
+    static register_type load(std::int16_t const* _p) {
+        return _mm512_loadu_si512(_p);
+    }
+    LIBQ_TARGET_AVX512
+    static void store(std::int16_t* _p, register_type const _v) {
+        _mm512_storeu_si512(_p, _v);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type broadcast(std::int16_t const _x) {
+        return _mm512_set1_epi16(_x);
+    }
+
+    LIBQ_TARGET_AVX512
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm512_add_epi16(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm512_sub_epi16(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return _mm512_xor_si512(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type bitwise_not(register_type const _a) {
+        return _mm512_xor_si512(_a, _mm512_set1_epi16(-1));
+    }
+    LIBQ_TARGET_AVX512
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return _mm512_and_si512(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return _mm512_maskz_mov_epi16(_mm512_cmpgt_epi16_mask(_a, _b),
+                                      _mm512_set1_epi16(-1));
+    }
+
+    LIBQ_TARGET_AVX512
+    static register_type shift_right(register_type const _v, int const _s) {
+        return _mm512_sra_epi16(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX512
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        return _mm512_srl_epi16(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX512
+    static register_type sign(register_type const _v) {
+        return _mm512_srai_epi16(_v, 15);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return _mm512_sub_epi16(_mm512_xor_si512(_v, _mask), _mask);
+    }
+};
+
+
+template<>
+class lanes<std::int32_t, libq::isa::avx512> {
+ public:
+    using register_type = __m512i;
+
+    enum: std::size_t { size = 16u };
+
+    LIBQ_TARGET_AVX512
+    static register_type load(std::int32_t const* _p) {
+        return _mm512_loadu_si512(_p);
+    }
+    LIBQ_TARGET_AVX512
+    static void store(std::int32_t* _p, register_type const _v) {
+        _mm512_storeu_si512(_p, _v);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type broadcast(std::int32_t const _x) {
+        return _mm512_set1_epi32(_x);
+    }
+
+    LIBQ_TARGET_AVX512
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm512_add_epi32(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm512_sub_epi32(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return _mm512_xor_si512(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type bitwise_not(register_type const _a) {
+        return _mm512_xor_si512(_a, _mm512_set1_epi32(-1));
+    }
+    LIBQ_TARGET_AVX512
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return _mm512_and_si512(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return _mm512_maskz_mov_epi32(_mm512_cmpgt_epi32_mask(_a, _b),
+                                      _mm512_set1_epi32(-1));
+    }
+
+    LIBQ_TARGET_AVX512
+    static register_type shift_right(register_type const _v, int const _s) {
+        return _mm512_sra_epi32(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX512
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        return _mm512_srl_epi32(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX512
+    static register_type sign(register_type const _v) {
+        return _mm512_srai_epi32(_v, 31);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return _mm512_sub_epi32(_mm512_xor_si512(_v, _mask), _mask);
+    }
+};
+
+
+template<>
+class lanes<std::int64_t, libq::isa::avx512> {
+ public:
+    using register_type = __m512i;
+
+    enum: std::size_t { size = 8u };
+
+    LIBQ_TARGET_AVX512
+    static register_type load(std::int64_t const* _p) {
+        return _mm512_loadu_si512(_p);
+    }
+    LIBQ_TARGET_AVX512
+    static void store(std::int64_t* _p, register_type const _v) {
+        _mm512_storeu_si512(_p, _v);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type broadcast(std::int64_t const _x) {
+        return _mm512_set1_epi64(_x);
+    }
+
+    LIBQ_TARGET_AVX512
+    static register_type add(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm512_add_epi64(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type sub(register_type const _a, register_type const _b) {  // NOLINT
+        return _mm512_sub_epi64(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type bitwise_xor(register_type const _a,
+                                     register_type const _b) {
+        return _mm512_xor_si512(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type bitwise_not(register_type const _a) {
+        return _mm512_xor_si512(_a, _mm512_set1_epi64(-1));
+    }
+    LIBQ_TARGET_AVX512
+    static register_type bitwise_and(register_type const _a,
+                                     register_type const _b) {
+        return _mm512_and_si512(_a, _b);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type greater(register_type const _a,
+                                 register_type const _b) {
+        return _mm512_maskz_mov_epi64(_mm512_cmpgt_epi64_mask(_a, _b),
+                                      _mm512_set1_epi64(-1));
+    }
+
+    LIBQ_TARGET_AVX512
+    static register_type shift_right(register_type const _v, int const _s) {
+        return _mm512_sra_epi64(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX512
+    static register_type shift_right_logical(register_type const _v,
+                                             int const _s) {
+        return _mm512_srl_epi64(_v, _mm_cvtsi32_si128(_s));
+    }
+    LIBQ_TARGET_AVX512
+    static register_type sign(register_type const _v) {
+        return _mm512_srai_epi64(_v, 63);
+    }
+    LIBQ_TARGET_AVX512
+    static register_type negate_if(register_type const _v,
+                                   register_type const _mask) {
+        return _mm512_sub_epi64(_mm512_xor_si512(_v, _mask), _mask);
+    }
+};
+#endif
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_LANES_INL_
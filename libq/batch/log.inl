@@ -0,0 +1,200 @@
+// log.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file log.inl
+
+ Provides the batch log function over the SIMD lanes
+*/
+
+#ifndef INC_LIBQ_BATCH_LOG_INL_
+#define INC_LIBQ_BATCH_LOG_INL_
+
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Runs the shift-and-add steps of libq::log<f> over the lanes.
+ \details The state of the lane is the normalized argument with 62
+ fractional bits (x) and the sum of the logarithms (y), the tag is the
+ binary exponent p. The step \f$x (1 + 2^{-i}) \leq 1\f$ is the mask of the
+ comparison, so the shift-and-add and the subtraction of the broadcast
+ logarithm are masked.
+*/
+template<typename Q>
+class batch_log_kernel {
+    using precision =
+        libq::details::precision_traits<Q::bits_for_fractional,
+                                        Q::bits_for_fractional>;
+    using work_type = libq::Q<57u,
+                              56u,
+                              0,
+                              typename Q::overflow_policy,
+                              typename Q::underflow_policy>;
+
+    enum: std::size_t {
+        steps = precision::iterations / 2u + 1u
+    };
+    using lut_type = libq::cordic::lut<steps, work_type>;
+
+ public:
+    using argument_type = Q;
+    using result_type = typename libq::details::log_of<
+        typename Q::storage_type,
+        Q::bits_for_integral,
+        Q::bits_for_fractional,
+        Q::scaling_factor_exponent,
+        typename Q::overflow_policy,
+        typename Q::underflow_policy>::promoted_type;
+    using lane_type = std::int64_t;
+    using tag_type = int;
+
+    static tag_type prepare(argument_type const _val,
+                            lane_type& _x,
+                            lane_type& _y,
+                            lane_type& _unused) {
+        assert(("[libq::batch::log] argument is negative", _val > Q(0)));
+        if (_val <= Q(0)) {
+            throw std::logic_error("[libq::batch::log]: argument is negative");  // NOLINT
+        }
+
+        // x from [0.5, 1) with 62 fractional bits
+        std::uint64_t const value = static_cast<std::uint64_t>(_val.value());
+        int const leading = libq::details::msb(value);
+
+        _x = static_cast<lane_type>((leading <= 61) ?
+            value << (61 - leading) : value >> (leading - 61));
+        _y = 0;
+        _unused = 0;
+
+        return leading + 1 - static_cast<int>(Q::bits_for_fractional) -
+            Q::scaling_factor_exponent;
+    }
+
+    template<class ISA>
+    static void iterate(lane_type* _x,
+                        lane_type* _y,
+                        lane_type*,
+                        std::size_t const _count) {
+        using lanes_type = libq::details::lanes<lane_type, ISA>;
+        using register_type = typename lanes_type::register_type;
+
+        static lut_type const logs = lut_type::log_one_plus();
+        register_type const one =
+            lanes_type::broadcast(std::int64_t(1) << 62);
+
+        for (std::size_t j = 0u; j < _count; j += lanes_type::size) {
+            register_type x = lanes_type::load(_x + j);
+            register_type y = lanes_type::load(_y + j);
+
+            for (std::size_t i = 0u; i != steps; ++i) {
+                register_type const increment =
+                    lanes_type::shift_right_logical(x, static_cast<int>(i) + 1);  // NOLINT
+                register_type const taken = lanes_type::bitwise_not(
+                    lanes_type::greater(lanes_type::add(x, increment), one));
+
+                x = lanes_type::add(x,
+                                    lanes_type::bitwise_and(increment, taken));  // NOLINT
+                y = lanes_type::sub(y, lanes_type::bitwise_and(
+                    lanes_type::broadcast(static_cast<lane_type>(logs[i].value())),  // NOLINT
+                    taken));
+            }
+
+            lanes_type::store(_x + j, x);
+            lanes_type::store(_y + j, y);
+        }
+    }
+
+    static result_type finish(lane_type const _x,
+                              lane_type const _y,
+                              lane_type const,
+                              tag_type const _power) {
+        enum: int {
+            fractional = static_cast<int>(work_type::bits_for_fractional),
+            result_fractional = static_cast<int>(result_type::bits_for_fractional) +  // NOLINT
+                result_type::scaling_factor_exponent
+        };
+        static libq::details::scaled_constant<libq::details::ln2_constant,
+                                              work_type::bits_for_fractional> const ln2;  // NOLINT
+
+        // ln(x) = x - 1 for the residual, see libq::log<f>
+        std::int64_t result = _y;
+        result -= static_cast<std::int64_t>(
+            ((std::uint64_t(1u) << 62) - static_cast<std::uint64_t>(_x)) >>
+                (62 - fractional));
+        result += _power * ln2.hi;
+
+        int const shift = fractional - result_fractional;
+        if (shift > 0) {
+            result = (result + (std::int64_t(1) << (shift - 1))) >> shift;
+        } else {
+            result <<= (-shift);
+        }
+
+        return result_type::wrap(
+            static_cast<typename result_type::storage_type>(result));
+    }
+};
+}  // namespace details
+
+
+namespace batch {
+/*!
+ \brief Computes the natural logarithms of the array:
+ _out[i] = libq::log<f>(_in[i]) for \f$i = 0, 1, ..., n - 1\f$.
+ \tparam ISA instruction set of the shift-and-add steps, see libq::isa: the
+ one of libq::isa::active() level by default
+ \details The normalization by the leading bit and the final rounding are
+ the scalar ones, the steps of the block run over the 64-bit SIMD lanes, see
+ libq::details::batch_log_kernel. The results are bit-identical to the ones
+ of libq::log<libq::engine::cordic>.
+ \throw std::logic_error if an argument is not positive
+*/
+template<class ISA = libq::isa::dispatched,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void log(libq::fixed_point<T, n, f, e, op, up> const* _in,
+         typename libq::details::log_of<T, n, f, e, op, up>::promoted_type* _out,  // NOLINT
+         std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_log_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform<kernel_type, ISA>::apply(_in, _out, _n);
+}
+
+
+/*!
+ \brief Computes the logarithms of the array by the chunks run as the policy
+ says: libq::parallel::sequenced_policy or libq::parallel::parallel_policy.
+ \details Every chunk runs the kernel of ISA, see libq::parallel::transform.
+*/
+template<class ISA = libq::isa::dispatched,
+         class Policy,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void log(Policy const& _policy,
+         libq::fixed_point<T, n, f, e, op, up> const* _in,
+         typename libq::details::log_of<T, n, f, e, op, up>::promoted_type* _out,  // NOLINT
+         std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_log_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform_by<kernel_type, ISA>(_policy, _in, _out, _n);  // NOLINT
+}
+}  // namespace batch
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_LOG_INL_
@@ -0,0 +1,87 @@
+// sincos.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sincos.inl
+
+ Provides the range reduction shared by the batch sin and cos functions
+*/
+
+#ifndef INC_LIBQ_BATCH_SINCOS_INL_
+#define INC_LIBQ_BATCH_SINCOS_INL_
+
+namespace libq {
+namespace details {
+/*!
+ \brief Prepares the CORDIC rotations of libq::sin<f> and libq::cos<f> for
+ libq::details::batch_transform.
+ \details The argument is reduced by libq::details::reduce_angle and the
+ rotation starts from the normalization factor like libq::details::sincos
+ does, the quadrant is the tag.
+*/
+template<typename Q>
+class batch_sincos_kernel {
+    using precision =
+        libq::details::precision_traits<Q::bits_for_fractional,
+                                        Q::bits_for_fractional>;
+
+ public:
+    using argument_type = Q;
+    using mode = libq::cordic::rotation;
+    using coordinates = libq::cordic::circular;
+    using work_type = libq::Q<precision::bits_for_fractional + 3u,
+                              precision::bits_for_fractional,
+                              Q::scaling_factor_exponent,
+                              typename Q::overflow_policy,
+                              typename Q::underflow_policy>;
+    using lane_type = typename libq::details::lane_of<work_type>::type;
+    using tag_type = int;
+
+    enum: std::size_t {
+        iterations = precision::iterations
+    };
+
+    static tag_type prepare(argument_type const _val,
+                       lane_type& _x,
+                       lane_type& _y,
+                       lane_type& _z) {
+        using engine_type = libq::cordic::engine<mode,
+                                                 coordinates,
+                                                 work_type,
+                                                 iterations>;
+        static work_type const norm_factor(1.0 / engine_type::gain());
+
+        work_type arg(0);
+        int const quadrant = libq::details::reduce_angle(_val, arg);
+
+        _x = static_cast<lane_type>(norm_factor.value());
+        _y = static_cast<lane_type>(work_type(0.0).value());
+        _z = static_cast<lane_type>(arg.value());
+
+        return quadrant;
+    }
+
+    template<class ISA>
+    static void iterate(lane_type* _x,
+                        lane_type* _y,
+                        lane_type* _z,
+                        std::size_t const _count) {
+        libq::details::batch_engine<mode,
+                                    coordinates,
+                                    work_type,
+                                    iterations,
+                                    ISA>::apply(_x, _y, _z, _count);
+    }
+
+ protected:
+    static work_type value_of(lane_type const _v) {
+        return work_type::wrap(
+            static_cast<typename work_type::storage_type>(_v));
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_SINCOS_INL_
@@ -0,0 +1,199 @@
+// sqrt.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sqrt.inl
+
+ Provides the batch sqrt function over the SIMD lanes
+*/
+
+#ifndef INC_LIBQ_BATCH_SQRT_INL_
+#define INC_LIBQ_BATCH_SQRT_INL_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Runs the digit-by-digit square root of the stored integer, see
+ libq::details::isqrt and libq::engine::digit_by_digit, over the lanes.
+ \details The state of the lane is the remainder (x) and the root (y). All
+ the lanes start from the bit of the widest radicand of the format instead
+ of the leading bit of their own: the leading zero bits of the root stay
+ zero, so the result does not change. The step \f$x \geq root + bit\f$ is
+ the mask of the comparison. The radicands of up to 30 bits are kept by the
+ 32-bit lanes.
+*/
+template<typename Q>
+class batch_sqrt_kernel {
+    using sqrt_type = typename libq::details::sqrt_of<
+        typename Q::storage_type,
+        Q::bits_for_integral,
+        Q::bits_for_fractional,
+        Q::scaling_factor_exponent,
+        typename Q::overflow_policy,
+        typename Q::underflow_policy>::promoted_type;
+
+    enum: int {
+        input_fractional = static_cast<int>(Q::bits_for_fractional) +
+            Q::scaling_factor_exponent,
+        output_fractional = static_cast<int>(sqrt_type::bits_for_fractional) +  // NOLINT
+            sqrt_type::scaling_factor_exponent,
+        shift = 2 * output_fractional - input_fractional,
+        left_shift = (shift > 0) ? shift : 0,
+        right_shift = (shift < 0) ? -shift : 0
+    };
+    enum: std::size_t {
+        radicand_bits = Q::number_of_significant_bits + left_shift -
+            right_shift,
+        steps = (radicand_bits + 1u) / 2u
+    };
+    static_assert(Q::number_of_significant_bits + left_shift <= 64u,
+                  "the shifted stored integer must fit the 64-bit word");
+
+ public:
+    using argument_type = Q;
+    using result_type = sqrt_type;
+    using lane_type = typename std::conditional<radicand_bits <= 30u,
+                                                std::int32_t,
+                                                std::int64_t>::type;
+    using tag_type = int;
+
+    static tag_type prepare(argument_type const _val,
+                            lane_type& _x,
+                            lane_type& _y,
+                            lane_type& _unused) {
+        assert(("[libq::batch::sqrt] argument is negative", _val >= Q(0)));
+        if (_val < Q(0)) {
+            throw std::logic_error("[libq::batch::sqrt]: argument is negative");  // NOLINT
+        }
+
+        _x = static_cast<lane_type>(
+            (static_cast<std::uint64_t>(_val.value()) << left_shift) >>
+                right_shift);
+        _y = 0;
+        _unused = 0;
+
+        return 0;
+    }
+
+    template<class ISA>
+    static void iterate(lane_type* _x,
+                        lane_type* _y,
+                        lane_type*,
+                        std::size_t const _count) {
+        using lanes_type = libq::details::lanes<lane_type, ISA>;
+        using register_type = typename lanes_type::register_type;
+
+        // the radicands of 64 bits are compared as the unsigned integers
+        register_type const bias = lanes_type::broadcast(
+            (radicand_bits < 64u) ? lane_type(0) :
+                                    std::numeric_limits<lane_type>::min());
+
+        for (std::size_t j = 0u; j < _count; j += lanes_type::size) {
+            register_type x = lanes_type::load(_x + j);
+            register_type root = lanes_type::load(_y + j);
+
+            for (std::size_t i = steps; i != 0u; --i) {
+                register_type const bit = lanes_type::broadcast(
+                    static_cast<lane_type>(std::uint64_t(1u) << (2u * (i - 1u))));  // NOLINT
+                register_type const candidate = lanes_type::add(root, bit);
+                register_type const taken = lanes_type::bitwise_not(
+                    lanes_type::greater(
+                        lanes_type::bitwise_xor(candidate, bias),
+                        lanes_type::bitwise_xor(x, bias)));
+
+                x = lanes_type::sub(x,
+                                    lanes_type::bitwise_and(candidate, taken));  // NOLINT
+                root = lanes_type::add(lanes_type::shift_right_logical(root, 1),
+                                       lanes_type::bitwise_and(bit, taken));
+            }
+
+            lanes_type::store(_x + j, x);
+            lanes_type::store(_y + j, root);
+        }
+    }
+
+    static result_type finish(lane_type const _x,
+                              lane_type const _root,
+                              lane_type const,
+                              tag_type const) {
+        using storage_type = typename result_type::storage_type;
+
+        // rounding of the largest argument can exceed the format
+        std::uint64_t const largest =
+            libq::details::largest_stored<result_type>();
+
+        std::uint64_t const x = static_cast<std::uint64_t>(_x);
+        std::uint64_t const root = static_cast<std::uint64_t>(_root);
+
+        return result_type::wrap(static_cast<storage_type>(
+            std::min((x > root) ? root + 1u : root, largest)));
+    }
+};
+}  // namespace details
+
+
+namespace batch {
+/*!
+ \brief Computes the square roots of the array:
+ _out[i] = libq::sqrt<libq::engine::digit_by_digit>(_in[i]) for
+ \f$i = 0, 1, ..., n - 1\f$.
+ \tparam ISA instruction set of the digit-by-digit steps, see libq::isa:
+ the one of libq::isa::active() level by default
+ \details The steps of the block run over the SIMD lanes, see
+ libq::details::batch_sqrt_kernel. The results are bit-identical to the
+ ones of the scalar function.
+ \throw std::logic_error if an argument is negative
+*/
+template<class ISA = libq::isa::dispatched,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void sqrt(libq::fixed_point<T, n, f, e, op, up> const* _in,
+          typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type* _out,  // NOLINT
+          std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_sqrt_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform<kernel_type, ISA>::apply(_in, _out, _n);
+}
+
+
+/*!
+ \brief Computes the square roots of the array by the chunks run as the
+ policy says: libq::parallel::sequenced_policy or
+ libq::parallel::parallel_policy.
+ \details Every chunk runs the kernel of ISA, see libq::parallel::transform.
+*/
+template<class ISA = libq::isa::dispatched,
+         class Policy,
+         typename T,
+         std::size_t n,
+         std::size_t f,
+         int e,
+         class op,
+         class up>
+void sqrt(Policy const& _policy,
+          libq::fixed_point<T, n, f, e, op, up> const* _in,
+          typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type* _out,  // NOLINT
+          std::size_t const _n) {
+    using kernel_type =
+        libq::details::batch_sqrt_kernel<libq::fixed_point<T, n, f, e, op, up> >;  // NOLINT
+
+    libq::details::batch_transform_by<kernel_type, ISA>(_policy, _in, _out, _n);  // NOLINT
+}
+}  // namespace batch
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_SQRT_INL_
@@ -0,0 +1,61 @@
+// clz.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file clz.inl
+
+ Gets the leading-zero count for the stored integers. It is used to normalize
+ the arguments of CORDIC routines in constant time.
+*/
+
+#ifndef INC_LIBQ_DETAILS_CLZ_INL_
+#define INC_LIBQ_DETAILS_CLZ_INL_
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace libq {
+namespace details {
+/*!
+ \brief Counts the leading zero bits of the non-zero 64-bit word.
+*/
+inline int clz(std::uint64_t _x) {
+#if defined(__GNUC__)
+    return __builtin_clzll(_x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index(0);
+    _BitScanReverse64(&index, _x);
+
+    return 63 - static_cast<int>(index);
+#else
+    // binary search takes 6 steps for any input
+    int n(0);
+    for (int shift = 32; shift != 0; shift >>= 1) {
+        if (!(_x >> (64 - shift))) {
+            n += shift;
+            _x <<= shift;
+        }
+    }
+
+    return n;
+#endif
+}
+
+
+/*!
+ \brief Gets the position of the most significant bit set in the positive
+ stored integer.
+*/
+template<typename T>
+inline int msb(T const _x) {
+    return 63 - libq::details::clz(static_cast<std::uint64_t>(_x));
+}
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_CLZ_INL_
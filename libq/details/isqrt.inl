@@ -0,0 +1,50 @@
+// isqrt.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file isqrt.inl
+
+ Provides the digit-by-digit square root of the 64-bit integer
+*/
+
+#ifndef INC_LIBQ_DETAILS_ISQRT_INL_
+#define INC_LIBQ_DETAILS_ISQRT_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes \f$\sqrt{x}\f$ rounded to the nearest integer.
+ \details Digit-by-digit (restoring) method: every step decides one bit of
+ the root by the single comparison and subtraction. The number of steps is
+ the half of the bit length of x, the first step is found by clz. Rounding is
+ exact: \f$r = \lfloor\sqrt{x}\rfloor\f$ is incremented iff the remainder
+ \f$x - r^2\f$ exceeds r, i.e. \f$x > (r + \frac{1}{2})^2\f$.
+*/
+inline std::uint64_t isqrt(std::uint64_t _x) {
+    if (_x == 0u) {
+        return 0u;
+    }
+
+    std::uint64_t root(0u);
+    std::uint64_t bit = std::uint64_t(1u) << (libq::details::msb(_x) & ~1);
+    while (bit != 0u) {
+        if (_x >= root + bit) {
+            _x -= root + bit;
+            root = (root >> 1u) + bit;
+        } else {
+            root >>= 1u;
+        }
+
+        bit >>= 2u;
+    }
+
+    return (_x > root) ? root + 1u : root;
+}
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_ISQRT_INL_
@@ -12,10 +12,28 @@
 #ifndef INC_STD_NUMERIC_LIMITS_INL_
 #define INC_STD_NUMERIC_LIMITS_INL_
 
+#include <cstdint>
 #include <limits>
 
 #define M_LOG10_2 0.301029995663981195214
 
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the largest stored integer of the format Q.
+ \note It is computed from Q::number_of_significant_bits, so the static member
+ Q::largest_stored_integer that has no out-of-line definition is not
+ odr-used.
+*/
+template<typename Q>
+constexpr std::uint64_t largest_stored() {
+    return (Q::number_of_significant_bits >= 64u) ? ~std::uint64_t(0u) :
+        (std::uint64_t(1u) << Q::number_of_significant_bits) - 1u;
+}
+}  // namespace details
+}  // namespace libq
+
+
 namespace std {
 
 template<typename T,
@@ -0,0 +1,65 @@
+// precision_traits.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file precision_traits.inl
+
+ \brief Gets the number of CORDIC iterations and guard bits required to get
+ the requested accuracy.
+*/
+
+#ifndef INC_LIBQ_DETAILS_PRECISION_TRAITS_INL_
+#define INC_LIBQ_DETAILS_PRECISION_TRAITS_INL_
+
+#include <boost/integer/static_log2.hpp>
+#include <boost/integer/static_min_max.hpp>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Describes the truncated CORDIC that computes just bits accurate
+ fractional bits out of f available ones.
+ \tparam bits number of accurate fractional bits requested by the caller
+ \tparam f number of fractional bits of the argument format
+ \note The angle residual after \f$k\f$ iterations is less than
+ \f$\arctan 2^{-(k-1)} < 2^{-(k-1)}\f$. So \f$bits + 2\f$ iterations bound the
+ approximation error by \f$2^{-(bits+1)}\f$. Every iteration truncates the
+ shifted coordinates, so \f$\lfloor\log_2(bits+2)\rfloor + 3\f$ guard bits
+ keep the accumulated rounding error below \f$2^{-(bits+1)}\f$ as well.
+ Thus, the absolute error of the result is bounded by \f$2^{-bits}\f$
+ (plus one ulp of the result format).
+ \note If \f$bits + guard\_bits > f\f$ then the format has no room for the
+ guard bits and the rounding error grows up to \f$2 \cdot f \cdot 2^{-f}\f$.
+ In particular, \f$bits = f\f$ gives the full-precision CORDIC.
+*/
+template<std::size_t bits, std::size_t f>
+class precision_traits {
+    static_assert(bits <= f, "requested accuracy exceeds the format precision");
+
+ public:
+    enum: std::size_t {
+        guard_bits = boost::static_log2<bits + 2u>::value + 3u,
+
+        iterations = boost::static_unsigned_min<bits + 2u, f>::value,
+        bits_for_fractional =
+            boost::static_unsigned_min<bits + guard_bits, f>::value
+    };
+
+    /*!
+     \brief Gets the upper bound for the absolute error of CORDIC result.
+    */
+    static double error_bound() {
+        double const approximation =
+            std::pow(2.0, -static_cast<double>(bits + 1u));
+        double const rounding = 2.0 * iterations *
+            std::pow(2.0, -static_cast<double>(bits_for_fractional));
+
+        return approximation + rounding;
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_PRECISION_TRAITS_INL_
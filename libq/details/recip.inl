@@ -0,0 +1,159 @@
+// recip.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file recip.inl
+
+ Provides the reciprocal function by Newton-Raphson iterations.
+*/
+
+#ifndef INC_LIBQ_DETAILS_RECIP_INL_
+#define INC_LIBQ_DETAILS_RECIP_INL_
+
+#include <boost/integer/static_min_max.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the format of the reciprocals of the fixed-point numbers.
+*/
+template<typename T>
+class recip_of {
+ public:
+    using promoted_type = T;
+};
+
+/*!
+ \note The reciprocal of the fixed-point number of format \f$(n, f, e)\f$
+ is from \f$[2^{-n}, 2^f]\f$ (up to the scaling factor). So it takes
+ \f$f + 1\f$ bits for the integral part. The rest of the widest word keeps
+ the fractional part, but no more than \f$n + f\f$ bits.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class recip_of<libq::fixed_point<T, n, f, e, op, up> > {
+    enum: std::size_t {
+        bits_for_integral = f + 1u,
+        bits_for_fractional = boost::static_unsigned_min<
+                                        n + f,
+                                        63u - bits_for_integral>::value
+    };
+
+ public:
+    using promoted_type = typename std::conditional<
+                            std::numeric_limits<T>::is_signed,
+                            libq::Q<bits_for_integral + bits_for_fractional,
+                                    bits_for_fractional,
+                                    -e,
+                                    op,
+                                    up>,
+                            libq::UQ<bits_for_integral + bits_for_fractional,
+                                     bits_for_fractional,
+                                     -e,
+                                     op,
+                                     up> >::type;
+};
+
+
+/*!
+ \brief Gets the number of Newton-Raphson iterations that double the number
+ of accurate bits of the seed.
+*/
+template<std::size_t significant_bits, std::size_t seed_bits>
+class newton_raphson_iterations {
+ public:
+    enum: std::size_t {
+        value = (significant_bits <= 2u * seed_bits) ? 1u :
+                (significant_bits <= 4u * seed_bits) ? 2u : 3u
+    };
+};
+
+
+/*!
+ \brief Computes \f$\frac1m\f$ for \f$m \in [0.5, 1)\f$ given with 64
+ fractional bits.
+ \tparam significant_bits number of accurate bits the caller needs
+ \return the reciprocal from \f$(1, 2]\f$ with 60 fractional bits
+ \details The seed \f$y_0 \approx \frac1m\f$ with 8 accurate bits is taken
+ from the LUT of 256 entries. Newton-Raphson iterations
+ \f$y_{k+1} = y_k + y_k (1 - m y_k)\f$ double the number of accurate bits
+ each.
+*/
+template<std::size_t significant_bits>
+std::int64_t reciprocal(std::uint64_t const _m) {
+    using seed_type = libq::UQ<63, 60>;
+    using lut_type = libq::cordic::lut<256u, seed_type>;
+    using iterations =
+        libq::details::newton_raphson_iterations<significant_bits, 8u>;
+
+    static lut_type const seeds = lut_type::reciprocal();
+
+    std::int64_t y = static_cast<std::int64_t>(seeds[(_m >> 55u) & 0xFFu].value());  // NOLINT
+
+    std::int64_t const one = std::int64_t(1) << 60u;
+    for (std::size_t i = 0u; i != iterations::value; ++i) {
+        std::int64_t const error = one - static_cast<std::int64_t>(
+            libq::details::mulhi(_m, static_cast<std::uint64_t>(y)));
+        y += libq::details::mulshift(y, error, 60u);
+    }
+
+    return y;
+}
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+/*!
+ \brief Computes \f$\frac1x\f$ without the fixed-point division.
+ \details
+ 1. The argument is normalized as \f$|x| = m \cdot 2^p\f$, where
+ \f$m \in [0.5, 1)\f$, by the leading bit position.
+ 2. \f$y = \frac1m\f$ is refined from the LUT seed by Newton-Raphson
+ iterations, see libq::details::reciprocal.
+ 3. The result is \f$y \cdot 2^{-p}\f$ rounded to the promoted format.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::recip_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    recip(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using recip_type = typename libq::details::recip_of<Q>::promoted_type;
+
+    std::int64_t const x = static_cast<std::int64_t>(_val.value());
+    assert(("[libq::recip] division by zero", x != 0));
+    if (x == 0) {
+        throw std::logic_error("[libq::recip]: division by zero");
+    }
+    bool const negative = (x < 0);
+    std::uint64_t const magnitude = negative ?
+        std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+        static_cast<std::uint64_t>(x);
+
+    // m from [0.5, 1) has 64 fractional bits, y has 60 ones
+    int const p = libq::details::msb(magnitude);
+    std::uint64_t const m = magnitude << (63 - p);
+    std::int64_t const y = libq::details::reciprocal<
+                                recip_type::number_of_significant_bits>(m);
+
+    // 1/x = y * 2^{f + e - p - 1}
+    int const shift = static_cast<int>(f) + e - p - 1 +
+        static_cast<int>(recip_type::bits_for_fractional) +
+        recip_type::scaling_factor_exponent - 60;
+    std::int64_t result(0);
+    if (shift >= 0) {
+        result = y << shift;
+    } else if (shift > -63) {
+        result = (y + (std::int64_t(1) << (-shift - 1))) >> (-shift);
+    }
+
+    return recip_type::wrap(static_cast<typename recip_type::storage_type>(
+        negative ? -result : result));
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_RECIP_INL_
@@ -0,0 +1,177 @@
+// reduce.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file reduce.inl
+
+ Reduces the arguments of elementary functions by the multiple of the
+ constant without the fixed-point division:
+ 1. trigonometric functions use \f$\frac{\pi}{2}\f$,
+ 2. hyperbolic and exponential ones use \f$\ln 2\f$.
+*/
+
+#ifndef INC_LIBQ_DETAILS_REDUCE_INL_
+#define INC_LIBQ_DETAILS_REDUCE_INL_
+
+#include <cstdint>
+#include <cmath>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Describes the constant \f$\frac{\pi}{2}\f$ as the double-double
+ number and its inverse.
+*/
+class pi_2_constant {
+ public:
+    static double hi() { return 1.5707963267948966; }
+    static double lo() { return 6.123233995736766e-17; }
+
+    /*!
+     \brief Gets \f$\frac{2}{\pi} < 2^{inverse\_bits - 64}\f$.
+    */
+    static double inverse() { return 0.636619772367581343076; }
+    enum: int { inverse_bits = 64 };
+};
+
+
+/*!
+ \brief Describes the constant \f$\ln 2\f$ as the double-double number and
+ its inverse.
+*/
+class ln2_constant {
+ public:
+    static double hi() { return 0.6931471805599453; }
+    static double lo() { return 2.3190468138462996e-17; }
+
+    /*!
+     \brief Gets \f$\log_2 e < 2^{inverse\_bits - 64}\f$.
+    */
+    static double inverse() { return 1.44269504088896340736; }
+    enum: int { inverse_bits = 63 };
+};
+
+
+/*!
+ \brief Keeps the constant C scaled by \f$2^S\f$ as the integer part hi and
+ the next 64 bits lo.
+ \details The constant is built from its double-double representation, so it
+ is known up to about 107 bits.
+*/
+template<class C, std::size_t S>
+class scaled_constant {
+    static_assert(S <= 61u, "the scaled constant must fit the 64-bit word");
+
+ public:
+    scaled_constant()
+        : hi(0), lo(0) {
+        double const h = std::ldexp(C::hi(), static_cast<int>(S));
+        double const l = std::ldexp(C::lo(), static_cast<int>(S));
+
+        // h is exact, the difference is exact because |h - a| <= 0.5
+        std::int64_t const a = std::llround(h);
+        double const d = (h - static_cast<double>(a)) + l;
+        double const b = std::floor(d);
+        double fraction = d - b;
+
+        hi = a + static_cast<std::int64_t>(b);
+        if (fraction >= 1.0) {
+            fraction = 0.0;
+            hi += 1;
+        }
+        lo = static_cast<std::uint64_t>(std::ldexp(fraction, 64));
+    }
+
+    std::int64_t hi;
+    std::uint64_t lo;
+};
+
+
+/*!
+ \brief Computes \f$k = round(\frac{x}{C})\f$ and the remainder
+ \f$r = x - k C \in [-\frac{C}{2}, \frac{C}{2}]\f$.
+ \tparam C constant, see libq::details::pi_2_constant
+ \tparam R fixed-point type of the remainder
+ \details Cody-Waite reduction in integers:
+ 1. \f$k\f$ is the high word of the 128-bit product of the stored integer and
+ the scaled inverse constant.
+ 2. \f$k C\f$ is subtracted in two steps: the scaled constant carries \f$S\f$
+ fractional bits and its next 64 bits correct the product. The subtraction
+ is done modulo \f$2^{64}\f$: the remainder is small, so the wrapped
+ intermediate values do not affect the result.
+ 3. The remainder is rounded down from \f$S\f$ fractional bits (8 guard ones)
+ to the format of R.
+
+ The absolute error of the remainder is within 1 ulp of R.
+*/
+template<class C, typename R, typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+std::int64_t reduce(libq::fixed_point<T, n, f, e, op, up> const _val, R& _r) {
+    enum: int {
+        input_fractional = static_cast<int>(f) + e,
+        output_fractional = static_cast<int>(R::bits_for_fractional) +
+            R::scaling_factor_exponent,
+        S = (output_fractional + 8 < 61) ? output_fractional + 8 : 61,
+        quotient_shift = input_fractional + C::inverse_bits - 64
+    };
+    static_assert(input_fractional >= 0 && output_fractional >= 0,
+                  "the reduction needs the non-negative number of fractional bits");  // NOLINT
+    static_assert(output_fractional <= S, "the remainder format is too wide");
+
+    static scaled_constant<C, S> const constant;
+    static std::uint64_t const inverse = static_cast<std::uint64_t>(
+        std::ldexp(C::inverse(), C::inverse_bits));
+
+    std::int64_t const x = static_cast<std::int64_t>(_val.value());
+    bool const negative = (x < 0);
+    std::uint64_t const magnitude = negative ?
+        std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+        static_cast<std::uint64_t>(x);
+
+    std::uint64_t quotient = libq::details::mulhi(magnitude, inverse);
+    if (quotient_shift > 0) {
+        quotient = (quotient + (std::uint64_t(1u) << (quotient_shift - 1))) >>
+            quotient_shift;
+    } else {
+        quotient <<= -quotient_shift;
+    }
+    std::int64_t const k = negative ? -static_cast<std::int64_t>(quotient) :
+                                      static_cast<std::int64_t>(quotient);
+
+    // remainder with S fractional bits
+    std::uint64_t const scaled_x = (input_fractional <= S) ?
+        static_cast<std::uint64_t>(x) << (S - input_fractional) :
+        static_cast<std::uint64_t>(x >> (input_fractional - S));
+
+    std::uint64_t const correction =
+        libq::details::mulhi(quotient, constant.lo);
+    std::uint64_t const product =
+        static_cast<std::uint64_t>(k) *
+            static_cast<std::uint64_t>(constant.hi) +
+        (negative ? std::uint64_t(0u) - correction : correction);
+
+    std::int64_t const remainder =
+        static_cast<std::int64_t>(scaled_x - product);
+
+    _r = R::wrap(static_cast<typename R::storage_type>(
+        remainder >> (S - output_fractional)));
+
+    return k;
+}
+
+
+/*!
+ \brief Computes the quadrant and the remainder
+ \f$r = x - k\frac{\pi}{2} \in [-\frac{\pi}{4}, \frac{\pi}{4}]\f$.
+ \return the quadrant index \f$k \bmod 4\f$
+*/
+template<typename R, typename Q>
+int reduce_angle(Q const _val, R& _r) {
+    return static_cast<int>(
+        libq::details::reduce<libq::details::pi_2_constant>(_val, _r) & 3);
+}
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_REDUCE_INL_
@@ -0,0 +1,126 @@
+// rsqrt.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file rsqrt.inl
+
+ Provides the reciprocal square root function by Newton-Raphson iterations.
+*/
+
+#ifndef INC_LIBQ_DETAILS_RSQRT_INL_
+#define INC_LIBQ_DETAILS_RSQRT_INL_
+
+#include <boost/integer/static_min_max.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the format of the reciprocal square roots of the fixed-point
+ numbers.
+*/
+template<typename T>
+class rsqrt_of {
+ public:
+    using promoted_type = T;
+};
+
+/*!
+ \note The reciprocal square root of the fixed-point number of format
+ \f$(n, f, e)\f$ is from \f$[2^{-n/2}, 2^{f/2}]\f$ (up to the scaling factor).
+ So it takes \f$\lfloor f/2 \rfloor + 1\f$ bits for the integral part. The
+ rest of the widest word keeps the fractional part, but no more than
+ \f$n + f\f$ bits.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class rsqrt_of<libq::fixed_point<T, n, f, e, op, up> > {
+    static_assert(e % 2 == 0, "the scaling factor exponent must be even");
+
+    enum: std::size_t {
+        bits_for_integral = f / 2u + 1u,
+        bits_for_fractional = boost::static_unsigned_min<
+                                        n + f,
+                                        63u - bits_for_integral>::value
+    };
+
+ public:
+    using promoted_type = libq::UQ<bits_for_integral + bits_for_fractional,
+                                   bits_for_fractional,
+                                   -e / 2,
+                                   op,
+                                   up>;
+};
+}  // namespace details
+}  // namespace libq
+
+
+namespace libq {
+/*!
+ \brief Computes \f$\frac1{\sqrt{x}}\f$ without the square root and the
+ fixed-point division.
+ \details
+ 1. The argument is normalized as \f$x = m \cdot 2^{2p}\f$, where
+ \f$m \in [0.25, 1)\f$, by the leading bit position.
+ 2. The seed \f$y_0 \approx \frac1{\sqrt{m}}\f$ with 8 accurate bits is taken
+ from the LUT of 192 entries.
+ 3. Newton-Raphson iterations \f$y_{k+1} = y_k + \frac{y_k}2 (1 - m y_k^2)\f$
+ double the number of accurate bits each.
+ 4. The result is \f$y \cdot 2^{-p}\f$ rounded to the promoted format.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::rsqrt_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    rsqrt(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using rsqrt_type = typename libq::details::rsqrt_of<Q>::promoted_type;
+    using seed_type = libq::UQ<63, 60, 0, op, up>;
+    using lut_type = libq::cordic::lut<192u, seed_type>;
+    using iterations = libq::details::newton_raphson_iterations<
+                                    rsqrt_type::number_of_significant_bits,
+                                    8u>;
+
+    static lut_type const seeds = lut_type::inv_sqrt();
+
+    std::int64_t const x = static_cast<std::int64_t>(_val.value());
+    assert(("[libq::rsqrt] argument is not positive", x > 0));
+    if (x <= 0) {
+        throw std::logic_error("[libq::rsqrt]: argument is not positive");
+    }
+    std::uint64_t const magnitude = static_cast<std::uint64_t>(x);
+
+    // x = m * 2^{2p}: m from [0.25, 1) has 64 fractional bits, y has 60 ones
+    int const msb = libq::details::msb(magnitude);
+    int const fraction_bits = static_cast<int>(f) + e;
+    bool const is_odd = ((msb + 1 - fraction_bits) & 1) != 0;
+    int const p = (msb + 1 - fraction_bits + (is_odd ? 1 : 0)) / 2;
+    std::uint64_t const m = magnitude << (is_odd ? 62 - msb : 63 - msb);
+    std::int64_t y = static_cast<std::int64_t>(seeds[(m >> 56u) - 64u].value());  // NOLINT
+
+    std::int64_t const one = std::int64_t(1) << 60u;
+    for (std::size_t i = 0u; i != iterations::value; ++i) {
+        std::int64_t const y2 = libq::details::mulshift(y, y, 60u);
+        std::int64_t const error = one - static_cast<std::int64_t>(
+            libq::details::mulhi(m, static_cast<std::uint64_t>(y2)));
+        y += libq::details::mulshift(y, error, 61u);
+    }
+
+    // 1/sqrt(x) = y * 2^{-p}
+    int const shift = static_cast<int>(rsqrt_type::bits_for_fractional) +
+        rsqrt_type::scaling_factor_exponent - p - 60;
+    std::int64_t result(0);
+    if (shift >= 0) {
+        result = y << shift;
+    } else if (shift > -63) {
+        result = (y + (std::int64_t(1) << (-shift - 1))) >> (-shift);
+    }
+
+    return rsqrt_type::wrap(
+        static_cast<typename rsqrt_type::storage_type>(result));
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_RSQRT_INL_
@@ -0,0 +1,98 @@
+// wide_mult.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file wide_mult.inl
+
+ Gets the 128-bit products of 64-bit stored integers. They are used if the
+ product of fixed-point numbers does not fit the widest built-in type.
+*/
+
+#ifndef INC_LIBQ_DETAILS_WIDE_MULT_INL_
+#define INC_LIBQ_DETAILS_WIDE_MULT_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the high 64 bits of the 128-bit product of unsigned words.
+*/
+inline std::uint64_t mulhi(std::uint64_t const _x, std::uint64_t const _y) {
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>(
+        (static_cast<unsigned __int128>(_x) * _y) >> 64u);
+#else
+    std::uint64_t const x0(_x & 0xFFFFFFFFu), x1(_x >> 32u);
+    std::uint64_t const y0(_y & 0xFFFFFFFFu), y1(_y >> 32u);
+
+    std::uint64_t const p00(x0 * y0), p01(x0 * y1), p10(x1 * y0);
+    std::uint64_t const middle((p00 >> 32u) + (p01 & 0xFFFFFFFFu) +
+                               (p10 & 0xFFFFFFFFu));
+
+    return x1 * y1 + (p01 >> 32u) + (p10 >> 32u) + (middle >> 32u);
+#endif
+}
+
+
+/*!
+ \brief Multiplies the stored integers and drops _shift low bits of the
+ 128-bit product, i.e. multiplies fixed-point numbers with _shift fractional
+ bits.
+ \note The magnitude of product is truncated. High bits are lost if the
+ result does not fit 64 bits.
+*/
+inline std::int64_t mulshift(std::int64_t const _x,
+                             std::int64_t const _y,
+                             std::size_t const _shift) {
+    bool const negative = ((_x < 0) != (_y < 0));
+    std::uint64_t const x = (_x < 0) ?
+        std::uint64_t(0u) - static_cast<std::uint64_t>(_x) :
+        static_cast<std::uint64_t>(_x);
+    std::uint64_t const y = (_y < 0) ?
+        std::uint64_t(0u) - static_cast<std::uint64_t>(_y) :
+        static_cast<std::uint64_t>(_y);
+
+    std::uint64_t const lo = x * y;
+    std::uint64_t const hi = libq::details::mulhi(x, y);
+    std::uint64_t const magnitude = (_shift == 0u) ? lo :
+        ((hi << (64u - _shift)) | (lo >> _shift));
+
+    return negative ? -static_cast<std::int64_t>(magnitude) :
+                      static_cast<std::int64_t>(magnitude);
+}
+
+
+/*!
+ \brief Multiplies like libq::details::mulshift does and sets _overflow if
+ the magnitude of the product does not fit 63 bits.
+*/
+inline std::int64_t mulshift(std::int64_t const _x,
+                             std::int64_t const _y,
+                             std::size_t const _shift,
+                             bool& _overflow) {
+    std::uint64_t const x = (_x < 0) ?
+        std::uint64_t(0u) - static_cast<std::uint64_t>(_x) :
+        static_cast<std::uint64_t>(_x);
+    std::uint64_t const y = (_y < 0) ?
+        std::uint64_t(0u) - static_cast<std::uint64_t>(_y) :
+        static_cast<std::uint64_t>(_y);
+
+    // the magnitude is the 64-bit window of the product above _shift bits,
+    // its highest bit is the sign one
+    std::uint64_t const hi = libq::details::mulhi(x, y);
+    bool const lost = (_shift == 0u) ?
+        (hi != 0u || ((x * y) >> 63u) != 0u) :
+        ((hi >> (_shift - 1u)) != 0u);
+    if (lost) {
+        _overflow = true;
+    }
+
+    return libq::details::mulshift(_x, _y, _shift);
+}
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_WIDE_MULT_INL_
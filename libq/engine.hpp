@@ -0,0 +1,249 @@
+// engine.hpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file engine.hpp
+
+ Provides the policies selecting the algorithm (engine) that computes the
+ elementary function for the fixed-point type.
+*/
+
+#ifndef INC_LIBQ_ENGINE_HPP_
+#define INC_LIBQ_ENGINE_HPP_
+
+#include <type_traits>
+
+namespace libq {
+/*!
+ \brief Tags of the engines computing the elementary functions.
+ \details The engine is selected either per call, for example
+ libq::sqrt<libq::engine::cordic>(x), or per type by the specialization of
+ libq::engine_of. Functions of the std namespace always use the engine of the
+ type.
+*/
+namespace engine {
+/*!
+ \brief CORDIC iterations.
+*/
+class cordic {
+};
+
+/*!
+ \brief CORDIC iterations resolving two bits of the angle per step, see
+ libq/CORDIC/radix4. The number of serial steps is halved, the result types
+ and the accuracy are the ones of libq::engine::cordic.
+*/
+class cordic_radix4 {
+};
+
+/*!
+ \brief Digit-by-digit algorithms on the stored integer.
+*/
+class digit_by_digit {
+};
+
+/*!
+ \brief Minimax polynomials of the reduced argument evaluated in 64-bit
+ integers, see libq/polynomial.
+*/
+class polynomial {
+};
+
+/*!
+ \brief Uniform tables with the linear interpolation, see libq/table. Tables
+ have 256-4096 entries, so the engine suits the narrow formats.
+*/
+class table {
+};
+}  // namespace engine
+
+
+/*!
+ \brief Tags of the elementary functions the engine can be selected for.
+*/
+namespace functions {
+class sqrt {
+};
+class sin {
+};
+class cos {
+};
+class exp {
+};
+class log {
+};
+class asin {
+};
+class acos {
+};
+class atan {
+};
+class tanh {
+};
+class sigmoid {
+};
+class erf {
+};
+class gelu {
+};
+}  // namespace functions
+
+
+namespace details {
+/*!
+ \brief Tells if the engine has the implementation of the function.
+*/
+template<class Engine, class Function>
+class engine_supports
+    : public std::false_type {
+};
+
+#define ENGINE_SUPPORTS(engine_name, function_name)\
+    template<>\
+    class engine_supports<libq::engine::engine_name,\
+                          libq::functions::function_name>\
+        : public std::true_type {\
+    };
+
+ENGINE_SUPPORTS(cordic, sqrt)
+ENGINE_SUPPORTS(cordic, sin)
+ENGINE_SUPPORTS(cordic, cos)
+ENGINE_SUPPORTS(cordic, exp)
+ENGINE_SUPPORTS(cordic, log)
+ENGINE_SUPPORTS(cordic, asin)
+ENGINE_SUPPORTS(cordic, acos)
+ENGINE_SUPPORTS(cordic, atan)
+ENGINE_SUPPORTS(cordic, tanh)
+ENGINE_SUPPORTS(cordic, sigmoid)
+
+ENGINE_SUPPORTS(cordic_radix4, sin)
+ENGINE_SUPPORTS(cordic_radix4, cos)
+ENGINE_SUPPORTS(cordic_radix4, asin)
+ENGINE_SUPPORTS(cordic_radix4, acos)
+ENGINE_SUPPORTS(cordic_radix4, atan)
+
+ENGINE_SUPPORTS(digit_by_digit, sqrt)
+
+ENGINE_SUPPORTS(polynomial, sin)
+ENGINE_SUPPORTS(polynomial, cos)
+ENGINE_SUPPORTS(polynomial, exp)
+ENGINE_SUPPORTS(polynomial, log)
+ENGINE_SUPPORTS(polynomial, atan)
+ENGINE_SUPPORTS(polynomial, tanh)
+
+ENGINE_SUPPORTS(table, sqrt)
+ENGINE_SUPPORTS(table, sin)
+ENGINE_SUPPORTS(table, cos)
+ENGINE_SUPPORTS(table, exp)
+ENGINE_SUPPORTS(table, log)
+ENGINE_SUPPORTS(table, atan)
+ENGINE_SUPPORTS(table, tanh)
+ENGINE_SUPPORTS(table, sigmoid)
+ENGINE_SUPPORTS(table, erf)
+ENGINE_SUPPORTS(table, gelu)
+
+#undef ENGINE_SUPPORTS
+
+
+/*!
+ \brief Gets the engine computing the function for the fixed-point type Q
+ if libq::engine_of is not specialized for it.
+*/
+template<typename Q, class Function>
+class default_engine_of {
+ public:
+    using type = libq::engine::cordic;
+};
+
+template<typename Q>
+class default_engine_of<Q, libq::functions::sqrt> {
+ public:
+    using type = libq::engine::digit_by_digit;
+};
+
+/*!
+ \brief The activation functions of libq/activation are computed by the
+ tables by default: they saturate, so the tables are short. The tables keep
+ up to 4096 entries, so the logistic function of the wide formats is
+ computed by CORDIC.
+*/
+template<typename Q>
+class default_engine_of<Q, libq::functions::sigmoid> {
+ public:
+    using type = typename std::conditional<
+        (static_cast<int>(Q::bits_for_fractional) + Q::scaling_factor_exponent <= 32),  // NOLINT
+        libq::engine::table,
+        libq::engine::cordic>::type;
+};
+
+template<typename Q>
+class default_engine_of<Q, libq::functions::erf> {
+ public:
+    using type = libq::engine::table;
+};
+
+template<typename Q>
+class default_engine_of<Q, libq::functions::gelu> {
+ public:
+    using type = libq::engine::table;
+};
+}  // namespace details
+
+
+/*!
+ \brief Gets the engine computing the function for the fixed-point type Q.
+ \details The library does not specialize the class, its defaults are the
+ ones of libq::details::default_engine_of. Specialize it to change the
+ engine, for example:
+ \code
+    namespace libq {
+    template<>
+    class engine_of<libq::Q<31, 28>, libq::functions::sqrt> {
+     public:
+        using type = libq::engine::cordic;
+    };
+    }  // namespace libq
+ \endcode
+ The partial specialization switches all the functions of the type at once,
+ like the overflow/underflow policies of libq::fixed_point do:
+ \code
+    namespace libq {
+    template<class Function>
+    class engine_of<libq::Q<15, 12>, Function> {
+     public:
+        using type = libq::engine::table;
+    };
+    }  // namespace libq
+ \endcode
+ The functions the engine has no implementation of, see
+ libq::details::engine_supports, keep the default engine: e.g. the table
+ engine above does not compute asin and acos, so they are computed by CORDIC.
+*/
+template<typename Q, class Function>
+class engine_of {
+ public:
+    using type = typename libq::details::default_engine_of<Q, Function>::type;
+};
+
+
+namespace details {
+/*!
+ \brief Gets the engine the functions of the std namespace use: the one of
+ libq::engine_of if it implements the function, the default one otherwise.
+*/
+template<typename Q, class Function>
+class selected_engine {
+    using chosen_type = typename libq::engine_of<Q, Function>::type;
+
+ public:
+    using type = typename std::conditional<
+        libq::details::engine_supports<chosen_type, Function>::value,
+        chosen_type,
+        typename libq::details::default_engine_of<Q, Function>::type>::type;
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_ENGINE_HPP_
@@ -206,9 +206,13 @@ class fixed_point {
      \brief Gets the maximum available fixed-point number.
     */
     static this_class largest() {
+        // wrap binds the reference, so the constant is copied not to odr-use
+        // the static member
+        typename this_class::largest_type const value =
+            this_class::largest_stored_integer;
+
         return
-            this_class::wrap<typename this_class::largest_type>(
-                                           this_class::largest_stored_integer);
+            this_class::wrap<typename this_class::largest_type>(value);
     }
 
 
@@ -221,8 +225,10 @@ class fixed_point {
      \brief Gets the minimum available fixed-point number.
     */
     static this_class least() {
+        std::intmax_t const value = this_class::least_stored_integer;
+
         return
-            this_class::wrap(this_class::least_stored_integer);
+            this_class::wrap(value);
     }
 
 
@@ -749,31 +755,114 @@ CONSTANT(CONST_2SQRT2, 2.82842712474619009760)
 #include "details/fmod.inl"
 #include "details/numeric_limits.inl"
 #include "details/type_traits.inl"
+#include "details/clz.inl"
+#include "details/isqrt.inl"
+#include "details/wide_mult.inl"
+#include "details/reduce.inl"
+#include "details/precision_traits.inl"
 
 #include "loop_unroller.hpp"
+#include "engine.hpp"
+#include "angle.hpp"
 
 
 #include "CORDIC/lut/lut.hpp"
+#include "CORDIC/engine.hpp"
+
+#include "details/recip.inl"
+#include "details/rsqrt.inl"
 
+#include "CORDIC/log2.inl"
 #include "CORDIC/log.inl"
+#include "CORDIC/log10.inl"
 #include "CORDIC/sqrt.inl"
 
+#include "CORDIC/sincos.inl"
 #include "CORDIC/sin.inl"
 #include "CORDIC/cos.inl"
 #include "CORDIC/tan.inl"
 
+#include "CORDIC/exp2.inl"
 #include "CORDIC/exp.inl"
+#include "CORDIC/pow.inl"
+#include "CORDIC/cbrt.inl"
 
+#include "CORDIC/sinhcosh.inl"
 #include "CORDIC/sinh.inl"
 #include "CORDIC/cosh.inl"
 #include "CORDIC/tanh.inl"
 
-#include "CORDIC/acos.inl"
 #include "CORDIC/asin.inl"
+#include "CORDIC/acos.inl"
 #include "CORDIC/atan.inl"
 
+#include "CORDIC/polar.inl"
+#include "CORDIC/atan2.inl"
+#include "CORDIC/hypot.inl"
+#include "CORDIC/rotate.inl"
+#include "CORDIC/angle.inl"
+
 #include "CORDIC/asinh.inl"
 #include "CORDIC/acosh.inl"
 #include "CORDIC/atanh.inl"
 
+#include "CORDIC/radix4/sincos.inl"
+#include "CORDIC/radix4/sin.inl"
+#include "CORDIC/radix4/cos.inl"
+#include "CORDIC/radix4/atan.inl"
+#include "CORDIC/radix4/asin.inl"
+#include "CORDIC/radix4/acos.inl"
+
+#include "polynomial/minimax.inl"
+#include "polynomial/horner.inl"
+#include "polynomial/sin.inl"
+#include "polynomial/cos.inl"
+#include "polynomial/exp.inl"
+#include "polynomial/log.inl"
+#include "polynomial/atan.inl"
+#include "polynomial/tanh.inl"
+
+#include "table/interpolation.inl"
+#include "table/sin.inl"
+#include "table/cos.inl"
+#include "table/exp.inl"
+#include "table/log.inl"
+#include "table/sqrt.inl"
+#include "table/atan.inl"
+#include "table/tanh.inl"
+#include "table/tabulated.inl"
+
+#include "activation/sigmoid.inl"
+#include "activation/erf.inl"
+#include "activation/gelu.inl"
+#include "activation/softmax.inl"
+
+#include "CORDIC/sincos_generator.inl"
+#include "nco.hpp"
+
+#include "parallel/policy.inl"
+#include "parallel/thread_pool.inl"
+#include "parallel/transform.inl"
+
+// the kernels call the lanes compiled for the wider targets, the calls are
+// inlined into libq::details::isa_entry, so the ABI of the registers never
+// matters
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+#include "batch/isa.inl"
+#include "batch/lanes.inl"
+#include "batch/engine.inl"
+#include "batch/sincos.inl"
+#include "batch/sin.inl"
+#include "batch/cos.inl"
+#include "batch/atan.inl"
+#include "batch/exp.inl"
+#include "batch/log.inl"
+#include "batch/sqrt.inl"
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
 #endif  // INC_LIBQ_FIXED_POINT_HPP_
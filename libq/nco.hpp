@@ -0,0 +1,307 @@
+// nco.hpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file nco.hpp
+
+ Provides the numerically controlled oscillator: the phase accumulator of
+ libq::angle followed by the sine/cosine output stage.
+*/
+
+#ifndef INC_LIBQ_NCO_HPP_
+#define INC_LIBQ_NCO_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace libq {
+/*!
+ \brief Tags of the output stages of libq::nco: they convert the phase to
+ the sine and the cosine.
+*/
+namespace nco_output {
+/*!
+ \brief CORDIC of the binary angle, see libq::sincos. The phase is rounded
+ to 4 bits more than the output has.
+*/
+class cordic {
+};
+
+/*!
+ \brief The table of \f$2^{log2\_entries}\f$ sines of the quarter wave
+ without the interpolation: the phase is rounded to the nearest entry. The
+ error is \f$\frac{\pi}{2^{log2\_entries + 2}}\f$ at most.
+*/
+template<std::size_t log2_entries = 10u>
+class quarter_wave {
+};
+
+/*!
+ \brief The tables of the table engine with the linear interpolation, see
+ libq::details::interpolated_sin_or_cos. The phase keeps all its bits.
+*/
+class interpolated {
+};
+}  // namespace nco_output
+
+
+namespace details {
+/*!
+ \brief Computes the sine and the cosine of the phase given by the stored
+ integer of libq::angle<PhaseBits>.
+*/
+template<class Output, std::size_t PhaseBits, typename Q>
+class nco_output_stage;
+
+
+template<std::size_t PhaseBits, typename Q>
+class nco_output_stage<libq::nco_output::cordic, PhaseBits, Q> {
+    enum: int {
+        output_fractional = static_cast<int>(Q::bits_for_fractional) +
+            Q::scaling_factor_exponent,
+        guarded = output_fractional + 4
+    };
+    enum: std::size_t {
+        angle_bits = (guarded < 4) ? 4u :
+                     (guarded > static_cast<int>(PhaseBits)) ? PhaseBits :
+                     static_cast<std::size_t>(guarded)
+    };
+
+    using angle_type = libq::angle<angle_bits>;
+
+ public:
+    static std::pair<Q, Q> apply(std::uint64_t const _phase) {
+        // the phase is rounded to the nearest angle_type unit
+        std::uint64_t const rounded = (angle_bits < PhaseBits) ?
+            (_phase + (std::uint64_t(1u) << (PhaseBits - angle_bits - 1u))) >>
+                (PhaseBits - angle_bits) :
+            _phase;
+
+        auto const v = libq::sincos(angle_type::wrap(
+            static_cast<typename angle_type::storage_type>(
+                rounded & ((std::uint64_t(1u) << angle_bits) - 1u))));
+
+        return std::make_pair(
+            libq::details::round_to<Q>(static_cast<std::int64_t>(v.first.value()),  // NOLINT
+                                       static_cast<int>(angle_bits) - 2),
+            libq::details::round_to<Q>(static_cast<std::int64_t>(v.second.value()),  // NOLINT
+                                       static_cast<int>(angle_bits) - 2));
+    }
+};
+
+
+template<std::size_t PhaseBits, typename Q, std::size_t log2_entries>
+class nco_output_stage<libq::nco_output::quarter_wave<log2_entries>,
+                       PhaseBits,
+                       Q> {
+    static_assert(log2_entries + 2u <= PhaseBits,
+                  "the table has more entries than the phase values");
+
+    using storage_type = typename Q::storage_type;
+
+    enum: std::size_t {
+        entries = std::size_t(1u) << log2_entries,
+        shift = PhaseBits - log2_entries - 2u
+    };
+
+    /*!
+     \brief Keeps \f$\sin \frac{\pi i}{2^{log2\_entries + 1}}\f$ for
+     \f$i = 0, 1, ..., 2^{log2\_entries}\f$.
+    */
+    class table_type
+        : public std::array<storage_type, entries + 1u> {
+     public:
+        table_type() {
+            enum: int {
+                output_fractional = static_cast<int>(Q::bits_for_fractional) +  // NOLINT
+                    Q::scaling_factor_exponent
+            };
+            double const step = 1.5707963267948966 / entries;
+
+            for (std::size_t i = 0u; i != entries + 1u; ++i) {
+                (*this)[i] = static_cast<storage_type>(std::llround(
+                    std::ldexp(std::sin(step * i), output_fractional)));
+            }
+        }
+    };
+
+    static Q value_of(table_type const& _table,
+                      std::size_t const _quadrant,
+                      std::size_t const _index) {
+        storage_type const v = (_quadrant & 1u) ?
+            _table[entries - _index] : _table[_index];
+
+        return Q::wrap(static_cast<storage_type>((_quadrant & 2u) ? -v : v));
+    }
+
+ public:
+    static std::pair<Q, Q> apply(std::uint64_t const _phase) {
+        static table_type const sines;
+
+        // the phase is rounded to the nearest entry of the full turn
+        std::uint64_t const u = (shift > 0u) ?
+            (_phase + (std::uint64_t(1u) << (shift - 1u))) >> shift : _phase;
+        std::size_t const quadrant =
+            static_cast<std::size_t>(u >> log2_entries) & 3u;
+        std::size_t const index = static_cast<std::size_t>(u) & (entries - 1u);
+
+        // cos(x) = sin(x + pi/2) is the next quadrant
+        return std::make_pair(value_of(sines, quadrant, index),
+                              value_of(sines, (quadrant + 1u) & 3u, index));
+    }
+};
+
+
+template<std::size_t PhaseBits, typename Q>
+class nco_output_stage<libq::nco_output::interpolated, PhaseBits, Q> {
+    using work_type = libq::Q<63, 60>;
+    using entries = libq::details::table_entries<
+        static_cast<int>(Q::bits_for_fractional) + Q::scaling_factor_exponent>;  // NOLINT
+
+ public:
+    static std::pair<Q, Q> apply(std::uint64_t const _phase) {
+        // the quadrant of the nearest quarter of the turn and the remainder
+        // from [-pi/4, pi/4), like libq::sincos of libq::angle does
+        std::int64_t const half = std::int64_t(1) << (PhaseBits - 3u);
+        std::int64_t const v = static_cast<std::int64_t>(_phase) + half;
+        int const quadrant = static_cast<int>((v >> (PhaseBits - 2u)) & 3);
+        std::int64_t const units =
+            (v & ((std::int64_t(1) << (PhaseBits - 2u)) - 1)) - half;
+
+        std::int64_t const r = static_cast<std::int64_t>(
+            libq::angle<PhaseBits>::template radians_of<work_type>(units).value());  // NOLINT
+        std::int64_t const y =
+            libq::details::interpolated_sin_or_cos<entries::log2_value>(r, true);  // NOLINT
+        std::int64_t const x =
+            libq::details::interpolated_sin_or_cos<entries::log2_value>(r, false);  // NOLINT
+
+        switch (quadrant) {
+        case 0:
+            return std::make_pair(libq::details::round_to<Q>(y),
+                                  libq::details::round_to<Q>(x));
+        case 1:
+            return std::make_pair(libq::details::round_to<Q>(x),
+                                  libq::details::round_to<Q>(-y));
+        case 2:
+            return std::make_pair(libq::details::round_to<Q>(-y),
+                                  libq::details::round_to<Q>(-x));
+        default:
+            return std::make_pair(libq::details::round_to<Q>(-x),
+                                  libq::details::round_to<Q>(y));
+        }
+    }
+};
+}  // namespace details
+
+
+/*!
+ \brief Numerically controlled oscillator: generates the samples
+ \f$\sin \phi_k\f$ and \f$\cos \phi_k\f$, where the phase
+ \f$\phi_{k + 1} = \phi_k + \Delta\f$ is accumulated modulo the full turn.
+ \tparam PhaseBits number of bits of the phase accumulator, see libq::angle
+ \tparam Q_out signed fixed-point type of the samples
+ \tparam Output output stage: libq::nco_output::cordic,
+ libq::nco_output::quarter_wave or libq::nco_output::interpolated
+ \details The phase and the tuning word \f$\Delta\f$ are libq::angle, so the
+ accumulation is the single integer addition that wraps around by itself: no
+ range reduction and no drift. The frequency of the output is
+ \f$\frac{\Delta}{2^{PhaseBits}} f_s\f$ for the sample rate \f$f_s\f$.
+
+ <B>Usage</B>
+ \code{.cpp}
+    using oscillator_type = libq::nco<32, libq::Q<15, 14> >;
+
+    oscillator_type oscillator(oscillator_type::tuning_word(1000.0, 48000.0));  // NOLINT
+
+    std::array<libq::Q<15, 14>, 256> sines, cosines;
+    oscillator.generate(sines.size(), sines.begin(), cosines.begin());
+
+    // the next block is generated at 1100 Hz from the phase reached
+    oscillator.tune(oscillator_type::tuning_word(1100.0, 48000.0));
+    oscillator.generate(sines.size(), sines.begin(), cosines.begin());
+ \endcode
+*/
+template<std::size_t PhaseBits,
+         typename Q_out,
+         class Output = libq::nco_output::cordic>
+class nco {
+    static_assert(Q_out::is_signed, "the samples must be signed");
+
+    using this_class = nco<PhaseBits, Q_out, Output>;
+    using stage_type =
+        libq::details::nco_output_stage<Output, PhaseBits, Q_out>;
+
+ public:
+    using phase_type = libq::angle<PhaseBits>;
+    using result_type = Q_out;
+
+    nco()
+        : m_phase(),
+          m_step() {}
+
+    explicit nco(phase_type const _step, phase_type const _phase = phase_type())  // NOLINT
+        : m_phase(_phase),
+          m_step(_step) {}
+
+    /*!
+     \brief Gets the tuning word of the frequency for the sample rate.
+    */
+    static phase_type tuning_word(double const _frequency,
+                                  double const _sample_rate) {
+        return phase_type::from_turns(_frequency / _sample_rate);
+    }
+
+    /*!
+     \brief Sets the tuning word: the samples generated next have the new
+     frequency and continue from the current phase.
+    */
+    void tune(phase_type const _step) { m_step = _step; }
+
+    /*!
+     \brief Sets the phase of the next sample.
+    */
+    void reset(phase_type const _phase = phase_type()) { m_phase = _phase; }
+
+    phase_type phase() const { return m_phase; }
+    phase_type step() const { return m_step; }
+
+    /*!
+     \brief Gets the sine and the cosine of the current phase and advances
+     it.
+    */
+    std::pair<result_type, result_type> operator()() {
+        std::pair<result_type, result_type> const result =
+            stage_type::apply(static_cast<std::uint64_t>(m_phase.value()));
+        m_phase += m_step;
+
+        return result;
+    }
+
+    /*!
+     \brief Generates the block of _count samples.
+     \param _sin, _cos beginnings of the sines and the cosines of type
+     result_type
+    */
+    template<class SinIterator, class CosIterator>
+    void generate(std::size_t const _count,
+                  SinIterator _sin,
+                  CosIterator _cos) {
+        for (std::size_t i = 0u; i != _count; ++i) {
+            std::pair<result_type, result_type> const v = (*this)();
+
+            *_sin++ = v.first;
+            *_cos++ = v.second;
+        }
+    }
+
+ private:
+    phase_type m_phase;
+    phase_type m_step;
+};
+}  // namespace libq
+
+#endif  // INC_LIBQ_NCO_HPP_
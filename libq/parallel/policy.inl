@@ -0,0 +1,59 @@
+// policy.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file policy.inl
+
+ Provides the execution policies of libq::parallel::transform and the batch
+ functions of libq/batch.
+*/
+
+#ifndef INC_LIBQ_PARALLEL_POLICY_INL_
+#define INC_LIBQ_PARALLEL_POLICY_INL_
+
+#include <cstddef>
+
+namespace libq {
+/*!
+ \brief Execution policies and the thread pool running the large arrays
+ over all the cores.
+*/
+namespace parallel {
+/*!
+ \brief Runs the whole array on the calling thread.
+*/
+class sequenced_policy {
+};
+
+/*!
+ \brief Splits the array into chunks run by libq::parallel::thread_pool.
+ \details The default chunk keeps the arguments and the results of half of
+ the L2 cache, so every chunk is computed in the cache of its core.
+*/
+class parallel_policy {
+ public:
+    /*!
+     \param _threads number of threads at most, all of the pool if zero
+     \param _chunk number of elements of the chunk, tuned to L2 if zero
+    */
+    constexpr explicit parallel_policy(std::size_t const _threads = 0u,
+                                       std::size_t const _chunk = 0u)
+        : m_threads(_threads),
+          m_chunk(_chunk) {}
+
+    constexpr std::size_t threads() const { return m_threads; }
+    constexpr std::size_t chunk() const { return m_chunk; }
+
+ private:
+    std::size_t m_threads;
+    std::size_t m_chunk;
+};
+
+constexpr libq::parallel::sequenced_policy seq{};
+constexpr libq::parallel::parallel_policy par{};
+}  // namespace parallel
+}  // namespace libq
+
+#endif  // INC_LIBQ_PARALLEL_POLICY_INL_
@@ -0,0 +1,288 @@
+// thread_pool.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file thread_pool.inl
+
+ Provides the work-stealing thread pool running the chunks of the arrays.
+*/
+
+#ifndef INC_LIBQ_PARALLEL_THREAD_POOL_INL_
+#define INC_LIBQ_PARALLEL_THREAD_POOL_INL_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace libq {
+namespace parallel {
+/*!
+ \brief Runs the chunks \f$0, 1, ..., chunks - 1\f$ of the job by the threads
+ started once and kept until the exit.
+ \details Every thread of the job owns the contiguous range of the chunks and
+ takes them from its front. The thread that has run out of its chunks steals
+ the back half of the range of the other one, so the threads finish together
+ even if the chunks are not equal. The calling thread runs the chunks too.
+
+ The pool runs one job at a time: the job started by the other thread or by
+ the chunk of the running job is run by the calling thread alone.
+*/
+class thread_pool {
+    using this_class = thread_pool;
+
+    /*!
+     \brief The chunks left to the thread: [first, last).
+    */
+    class range {
+     public:
+        range()
+            : first(0u),
+              last(0u) {}
+
+        std::mutex mutex;
+        std::size_t first;
+        std::size_t last;
+
+     private:
+        // keeps the ranges of the threads in the different cache lines
+        char padding[64];
+    };
+
+ public:
+    /*!
+     \brief Gets the pool of std::thread::hardware_concurrency() threads
+     including the calling one.
+    */
+    static thread_pool& instance() {
+        static thread_pool pool(std::thread::hardware_concurrency());
+
+        return pool;
+    }
+
+    explicit thread_pool(std::size_t const _concurrency)
+        : m_ranges(new range[(_concurrency > 1u) ? _concurrency : 1u]),
+          m_concurrency((_concurrency > 1u) ? _concurrency : 1u),
+          m_generation(0u),
+          m_participants(0u),
+          m_active(0u),
+          m_stop(false),
+          m_failed(false),
+          m_invoke(nullptr),
+          m_context(nullptr) {
+        for (std::size_t i = 1u; i != m_concurrency; ++i) {
+            m_workers.emplace_back(&this_class::serve, this, i);
+        }
+    }
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    thread_pool(this_class const&) = delete;
+    this_class& operator=(this_class const&) = delete;
+
+    /*!
+     \brief Gets the number of the threads including the calling one.
+    */
+    std::size_t concurrency() const { return m_concurrency; }
+
+    /*!
+     \brief Calls _f(i) for the chunks \f$i = 0, 1, ..., chunks - 1\f$ by
+     _threads threads at most.
+     \details The first exception thrown by _f is rethrown after all the
+     threads have stopped, the chunks not started yet are skipped.
+    */
+    template<class F>
+    void run(std::size_t const _chunks, std::size_t const _threads, F& _f) {
+        std::size_t participants = (_threads < m_concurrency) ?
+            _threads : m_concurrency;
+        participants = (_chunks < participants) ? _chunks : participants;
+
+        std::unique_lock<std::mutex> job(m_job, std::try_to_lock);
+        if (participants <= 1u || !job.owns_lock()) {
+            for (std::size_t i = 0u; i != _chunks; ++i) {
+                _f(i);
+            }
+            return;
+        }
+
+        for (std::size_t i = 0u; i != participants; ++i) {
+            m_ranges[i].first = _chunks * i / participants;
+            m_ranges[i].last = _chunks * (i + 1u) / participants;
+        }
+        m_failed.store(false, std::memory_order_relaxed);
+        m_error = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_invoke = &this_class::invoke<F>;
+            m_context = &_f;
+            m_participants = participants;
+            m_active = participants - 1u;
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        this->work(0u);
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this]() { return m_active == 0u; });
+        }
+
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+ private:
+    template<class F>
+    static void invoke(void* const _context, std::size_t const _chunk) {
+        (*static_cast<F*>(_context))(_chunk);
+    }
+
+    /*!
+     \brief Waits for the jobs the thread _index takes part in.
+    */
+    void serve(std::size_t const _index) {
+        std::size_t generation(0u);
+
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [this, generation]() {
+                    return m_stop || m_generation != generation;
+                });
+                if (m_stop) {
+                    return;
+                }
+
+                generation = m_generation;
+                if (_index >= m_participants) {
+                    continue;
+                }
+            }
+
+            this->work(_index);
+
+            bool last(false);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                last = (--m_active == 0u);
+            }
+            if (last) {
+                m_done.notify_one();
+            }
+        }
+    }
+
+    /*!
+     \brief Runs the chunks of the thread _index and steals the ones of the
+     others until all the ranges are empty.
+    */
+    void work(std::size_t const _index) {
+        for (;;) {
+            std::size_t chunk(0u);
+            if (!this->pop(_index, chunk) && !this->steal(_index, chunk)) {
+                return;
+            }
+
+            if (m_failed.load(std::memory_order_relaxed)) {
+                continue;
+            }
+
+            try {
+                m_invoke(m_context, chunk);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_error) {
+                    m_error = std::current_exception();
+                }
+                m_failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(std::size_t const _index, std::size_t& _chunk) {
+        range& own = m_ranges[_index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.first == own.last) {
+            return false;
+        }
+
+        _chunk = own.first++;
+        return true;
+    }
+
+    /*!
+     \brief Moves the back half of the range of the other thread to the
+     thread _index and takes its first chunk.
+    */
+    bool steal(std::size_t const _index, std::size_t& _chunk) {
+        for (std::size_t i = 1u; i != m_participants; ++i) {
+            range& victim = m_ranges[(_index + i) % m_participants];
+
+            std::size_t first(0u), last(0u);
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                std::size_t const left = victim.last - victim.first;
+                if (left == 0u) {
+                    continue;
+                }
+
+                last = victim.last;
+                first = last - (left + 1u) / 2u;
+                victim.last = first;
+            }
+
+            range& own = m_ranges[_index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.first = first + 1u;
+            own.last = last;
+            _chunk = first;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    std::unique_ptr<range[]> m_ranges;
+    std::size_t const m_concurrency;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_job;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::size_t m_generation;
+    std::size_t m_participants;
+    std::size_t m_active;
+    bool m_stop;
+
+    std::atomic<bool> m_failed;
+    std::exception_ptr m_error;
+
+    void (*m_invoke)(void*, std::size_t);
+    void* m_context;
+};
+}  // namespace parallel
+}  // namespace libq
+
+#endif  // INC_LIBQ_PARALLEL_THREAD_POOL_INL_
@@ -0,0 +1,169 @@
+// transform.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file transform.inl
+
+ Provides libq::parallel::transform and the splitting of the arrays into the
+ chunks sized by the L2 cache.
+*/
+
+#ifndef INC_LIBQ_PARALLEL_TRANSFORM_INL_
+#define INC_LIBQ_PARALLEL_TRANSFORM_INL_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace libq {
+namespace parallel {
+namespace details {
+/*!
+ \brief Gets the size of the L2 cache of the core in bytes: 256 KiB if the
+ system does not tell it.
+*/
+inline std::size_t l2_cache_size() {
+    static std::size_t const result = []() -> std::size_t {
+        std::size_t const fallback = 256u * 1024u;
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+        long const size = ::sysconf(_SC_LEVEL2_CACHE_SIZE);
+        return (size > 0) ? static_cast<std::size_t>(size) : fallback;
+#else
+        return fallback;
+#endif
+    }();
+
+    return result;
+}
+
+
+/*!
+ \brief Gets the number of the elements of the chunk: the arguments and the
+ results of the chunk fill half of L2, but every thread gets 4 chunks at
+ least, so the stealing balances the threads.
+ \param _bytes bytes of the argument and the result of one element
+ \param _grain the chunk is the multiple of it
+*/
+inline std::size_t chunk_size(libq::parallel::parallel_policy const& _policy,
+                              std::size_t const _n,
+                              std::size_t const _threads,
+                              std::size_t const _bytes,
+                              std::size_t const _grain) {
+    // the smaller chunks cost more than the wake-up of the thread
+    std::size_t const smallest = 4096u;
+
+    std::size_t chunk = _policy.chunk();
+    if (chunk == 0u) {
+        std::size_t const cached = libq::parallel::details::l2_cache_size() / 2u / _bytes;  // NOLINT
+        std::size_t const balanced = _n / (4u * _threads);
+
+        chunk = std::max(std::min(cached, balanced), smallest);
+    }
+
+    return (chunk + _grain - 1u) / _grain * _grain;
+}
+
+
+/*!
+ \brief Calls _f(first, last) for the chunks [first, last) of [0, _n).
+*/
+template<class F>
+void for_each_chunk(libq::parallel::sequenced_policy const&,
+                    std::size_t const _n,
+                    std::size_t const,
+                    std::size_t const,
+                    F const& _f) {
+    _f(std::size_t(0u), _n);
+}
+
+template<class F>
+void for_each_chunk(libq::parallel::parallel_policy const& _policy,
+                    std::size_t const _n,
+                    std::size_t const _bytes,
+                    std::size_t const _grain,
+                    F const& _f) {
+    libq::parallel::thread_pool& pool =
+        libq::parallel::thread_pool::instance();
+
+    std::size_t const threads =
+        (_policy.threads() == 0u || _policy.threads() > pool.concurrency()) ?
+            pool.concurrency() : _policy.threads();
+    std::size_t const chunk = libq::parallel::details::chunk_size(
+        _policy, _n, threads, _bytes, _grain);
+    std::size_t const chunks = (_n + chunk - 1u) / chunk;
+
+    auto run_chunk = [&_f, _n, chunk](std::size_t const _i) {
+        std::size_t const first = _i * chunk;
+        _f(first, std::min(first + chunk, _n));
+    };
+    pool.run(chunks, threads, run_chunk);
+}
+}  // namespace details
+
+
+/*!
+ \brief Computes _out[i] = _fn(_first[i]) for the elements of
+ [_first, _last) like std::transform does.
+ \tparam Policy libq::parallel::sequenced_policy or
+ libq::parallel::parallel_policy
+ \details The parallel policy splits the range into chunks run by
+ libq::parallel::thread_pool, so _fn is called by several threads at once.
+ The iterators are random-access ones.
+ \return the end of the results
+
+ <B>Usage</B>
+ \code{.cpp}
+    using Q = libq::Q<31, 28>;
+
+    std::vector<Q> angles(100000000u, Q(0.5));
+    std::vector<libq::Q<1, 28> > sines(angles.size());
+
+    libq::parallel::transform(libq::parallel::par,
+                              angles.begin(),
+                              angles.end(),
+                              sines.begin(),
+                              [](Q const x) { return std::sin(x); });
+ \endcode
+*/
+template<class Policy,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryFunction>
+OutputIterator transform(Policy const& _policy,
+                         InputIterator const _first,
+                         InputIterator const _last,
+                         OutputIterator const _out,
+                         UnaryFunction const _fn) {
+    using argument_type =
+        typename std::iterator_traits<InputIterator>::value_type;
+    using result_type = decltype(_fn(*_first));
+
+    std::size_t const n = static_cast<std::size_t>(std::distance(_first, _last));  // NOLINT
+
+    libq::parallel::details::for_each_chunk(
+        _policy,
+        n,
+        sizeof(argument_type) + sizeof(result_type),
+        1u,
+        [_first, _out, &_fn](std::size_t const _from, std::size_t const _to) {
+            using difference_type =
+                typename std::iterator_traits<InputIterator>::difference_type;
+
+            std::transform(_first + static_cast<difference_type>(_from),
+                           _first + static_cast<difference_type>(_to),
+                           _out + static_cast<difference_type>(_from),
+                           _fn);
+        });
+
+    return _out + static_cast<typename std::iterator_traits<OutputIterator>::difference_type>(n);  // NOLINT
+}
+}  // namespace parallel
+}  // namespace libq
+
+#endif  // INC_LIBQ_PARALLEL_TRANSFORM_INL_
@@ -0,0 +1,112 @@
+// atan.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file atan.inl
+
+ Provides the minimax polynomial engine for atan function
+*/
+
+#ifndef INC_LIBQ_POLYNOMIAL_ATAN_INL_
+#define INC_LIBQ_POLYNOMIAL_ATAN_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Reduces the magnitude of the arctangent's argument to
+ \f$u = \min(|x|, \frac1{|x|}) \in [0, 1]\f$.
+ \param _magnitude stored integer of \f$|x|\f$ with _bits fractional bits
+ \param[out] _inverted is true if \f$u = \frac1{|x|}\f$
+ \return u with 60 fractional bits
+*/
+inline std::int64_t reduce_atan(std::uint64_t const _magnitude,
+                                int const _bits,
+                                bool& _inverted) {
+    int const p = libq::details::msb(_magnitude);
+    _inverted = (p >= _bits) && (_magnitude != (std::uint64_t(1u) << _bits));
+    if (_inverted) {
+        // |x| = m 2^{p + 1 - bits}, where m is from [0.5, 1)
+        std::int64_t const y = libq::details::reciprocal<60u>(
+            _magnitude << (63 - p));
+        int const shift = p + 1 - _bits;
+
+        return (shift < 63) ? (y >> shift) : 0;
+    }
+
+    return (_bits <= 60) ?
+        static_cast<std::int64_t>(_magnitude << (60 - _bits)) :
+        static_cast<std::int64_t>(_magnitude >> (_bits - 60));
+}
+
+
+/*!
+ \brief Computes the arctangent by the minimax polynomial.
+ \details The argument is reduced to \f$s \in [-\tan\frac{\pi}{8},
+ \tan\frac{\pi}{8}]\f$ by two identities:
+ 1. \f$\arctan |x| = \frac{\pi}{2} - \arctan\frac{1}{|x|}\f$ for
+ \f$|x| > 1\f$,
+ 2. \f$\arctan u = \frac{\pi}{4} + \arctan\frac{u - 1}{u + 1}\f$ for
+ \f$u > \tan\frac{\pi}{8}\f$.
+
+ The reciprocals are computed by libq::details::reciprocal, so there are no
+ divisions. Then \f$\arctan s = s P(s^2)\f$.
+ \note The absolute error is bounded by
+ \f$0.42\f$ libq::details::minimax<libq::functions::atan, bits>::error_bound()
+ plus \f$2^{-56}\f$ and 0.5 ulp of the result format.
+*/
+template<>
+class atan_impl<libq::engine::polynomial> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using atan_type =
+            typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using format = libq::details::polynomial_format;
+        using accuracy = libq::details::accuracy_class<static_cast<int>(f) + e>;  // NOLINT
+        using polynomial =
+            libq::details::minimax<libq::functions::atan, accuracy::value>;
+
+        std::int64_t const x = static_cast<std::int64_t>(_val.value());
+        if (x == 0) {
+            return atan_type(0);
+        }
+        bool const negative = (x < 0);
+        std::uint64_t const magnitude = negative ?
+            std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+            static_cast<std::uint64_t>(x);
+
+        bool inverted(false);
+        std::int64_t const u = libq::details::reduce_atan(
+            magnitude, static_cast<int>(f) + e, inverted);
+
+        // s = (u - 1) / (u + 1), where (u + 1) / 2 is from (0.6, 1]
+        std::int64_t base(0), s(u);
+        if (u > format::tan_pi_8()) {
+            base = format::pi_4();
+            s = 0;
+            if (u < format::one()) {
+                std::int64_t const y = libq::details::reciprocal<60u>(
+                    static_cast<std::uint64_t>(u + format::one()) << 3u);
+                s = libq::details::mulshift(u - format::one(), y, 61u);
+            }
+        }
+
+        std::int64_t const z = libq::details::mulshift(s, s, 60u);
+        std::int64_t result = base + libq::details::mulshift(
+            s, libq::details::horner<polynomial>(z), 60u);
+        if (inverted) {
+            result = format::pi_2() - result;
+        }
+
+        return libq::details::round_to<atan_type>(negative ? -result : result);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_POLYNOMIAL_ATAN_INL_
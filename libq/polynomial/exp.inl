@@ -0,0 +1,79 @@
+// exp.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file exp.inl
+
+ Provides the minimax polynomial engine for exp function
+*/
+
+#ifndef INC_LIBQ_POLYNOMIAL_EXP_INL_
+#define INC_LIBQ_POLYNOMIAL_EXP_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Rounds \f$m 2^k\f$ to the format R.
+ \param _m mantissa from \f$[0.5, 2)\f$ with 60 fractional bits
+ \details The result is saturated if it exceeds the format.
+*/
+template<typename R>
+R scale_exp(std::int64_t const _m, std::int64_t const _k) {
+    R const largest = R::wrap(static_cast<typename R::storage_type>(
+        libq::details::largest_stored<R>()));
+
+    // m < 2^{61}, so two more bits still fit the 64-bit word
+    if (_k > 62) {
+        return largest;
+    }
+    int const bits = static_cast<int>(60 - _k);
+    int const shift = bits - static_cast<int>(R::bits_for_fractional) -
+        R::scaling_factor_exponent;
+    if (shift < -2) {
+        return largest;
+    }
+
+    return libq::details::round_to<R>(_m, bits);
+}
+
+
+/*!
+ \brief Computes the exponent by the minimax polynomial.
+ \details The argument is reduced as \f$x = k \ln 2 + r\f$, so
+ \f$e^x = 2^k P(r)\f$ costs the single shift. The result is saturated if it
+ exceeds the format.
+ \note The relative error is bounded by
+ \f$\sqrt{2}\f$ libq::details::minimax<libq::functions::exp, bits>::error_bound()
+ plus \f$2^{-58}\f$. The absolute error is 0.5 ulp of the result format more.
+*/
+template<>
+class exp_impl<libq::engine::polynomial> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using exp_type =
+            typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using work_type = libq::Q<63, 60, 0, op, up>;
+        using accuracy = libq::details::accuracy_class<static_cast<int>(f) + e>;  // NOLINT
+        using polynomial =
+            libq::details::minimax<libq::functions::exp, accuracy::value>;
+
+        work_type r(0);
+        std::int64_t const k =
+            libq::details::reduce<libq::details::ln2_constant>(_val, r);
+
+        return libq::details::scale_exp<exp_type>(
+            libq::details::horner<polynomial>(
+                static_cast<std::int64_t>(r.value())),
+            k);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_POLYNOMIAL_EXP_INL_
@@ -0,0 +1,108 @@
+// horner.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file horner.inl
+
+ Provides the evaluation of minimax polynomials in the promoted fixed-point
+ format libq::Q<63, 60>
+*/
+
+#ifndef INC_LIBQ_POLYNOMIAL_HORNER_INL_
+#define INC_LIBQ_POLYNOMIAL_HORNER_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Describes the work format of the polynomial engine: the stored
+ integers have 60 fractional bits, i.e. the format is libq::Q<63, 60>.
+*/
+class polynomial_format {
+ public:
+    enum: int { bits_for_fractional = 60 };
+
+    static std::int64_t one() { return INT64_C(1) << 60; }
+    static std::int64_t pi_2() { return INT64_C(1811004864519280711); }
+    static std::int64_t pi_4() { return INT64_C(905502432259640355); }
+    static std::int64_t sqrt2() { return INT64_C(1630477228166597777); }
+    static std::int64_t tan_pi_8() { return INT64_C(477555723559750801); }
+
+    /*!
+     \brief Gets \f$\ln 2\f$ scaled by \f$2^{62}\f$.
+    */
+    static std::int64_t ln2() { return INT64_C(3196577161300663915); }
+};
+
+
+/*!
+ \brief Gets the accuracy class of the minimax polynomial, see
+ libq::details::minimax, for the result with bits fractional bits.
+*/
+template<int bits>
+class accuracy_class {
+ public:
+    enum: std::size_t {
+        value = (bits <= 16) ? 16u :
+                (bits <= 24) ? 24u :
+                (bits <= 32) ? 32u :
+                (bits <= 40) ? 40u :
+                (bits <= 48) ? 48u : 56u
+    };
+};
+
+
+/*!
+ \brief Evaluates the polynomial by Horner scheme.
+ \param _x argument with 60 fractional bits
+ \return the value with 60 fractional bits
+ \note Every step truncates the product, so the rounding error is bounded by
+ \f$degree \cdot 2^{-60}\f$ for \f$|x| \leq 1\f$.
+*/
+template<class Polynomial>
+std::int64_t horner(std::int64_t const _x) {
+    std::int64_t const* const coefficients = Polynomial::coefficients();
+    std::int64_t result = coefficients[Polynomial::degree];
+
+#ifdef LOOP_UNROLLING
+    auto const iteration_body = [&](std::size_t i) {  // NOLINT
+#else
+    for (std::size_t i = 0u; i != Polynomial::degree; ++i) {
+#endif
+        result = libq::details::mulshift(result, _x, 60u) +
+            coefficients[Polynomial::degree - 1u - i];
+    };  // NOLINT
+#ifdef LOOP_UNROLLING
+    libq::details::unroll(iteration_body,
+                          0u,
+                          libq::details::loop_size<Polynomial::degree - 1u>());  // NOLINT
+#endif
+
+    return result;
+}
+
+
+/*!
+ \brief Rounds the number with _bits fractional bits to the format R.
+*/
+template<typename R>
+R round_to(std::int64_t const _x, int const _bits = 60) {
+    int const shift = _bits - static_cast<int>(R::bits_for_fractional) -
+        R::scaling_factor_exponent;
+
+    std::int64_t result(0);
+    if (shift <= 0) {
+        result = (shift > -63) ? (_x << (-shift)) : 0;
+    } else if (shift < 63) {
+        result = (_x + (std::int64_t(1) << (shift - 1))) >> shift;
+    }
+
+    return R::wrap(static_cast<typename R::storage_type>(result));
+}
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_POLYNOMIAL_HORNER_INL_
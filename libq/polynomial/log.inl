@@ -0,0 +1,109 @@
+// log.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file log.inl
+
+ Provides the minimax polynomial engine for log function
+*/
+
+#ifndef INC_LIBQ_POLYNOMIAL_LOG_INL_
+#define INC_LIBQ_POLYNOMIAL_LOG_INL_
+
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Normalizes the positive argument of the logarithm as
+ \f$x = (1 + t) 2^k\f$ with \f$1 + t \in [\frac{\sqrt{2}}{2}, \sqrt{2})\f$.
+ \param _x stored integer with _bits fractional bits
+ \return t with 60 fractional bits
+*/
+inline std::int64_t reduce_log(std::int64_t const _x,
+                               int const _bits,
+                               std::int64_t& _k) {
+    using format = libq::details::polynomial_format;
+
+    // mantissa from [1, 2) with 60 fractional bits
+    int const p = libq::details::msb(_x);
+    std::int64_t m = (p <= 60) ? (_x << (60 - p)) : (_x >> (p - 60));
+    _k = p - _bits;
+    if (m >= format::sqrt2()) {
+        m >>= 1;
+        _k += 1;
+    }
+
+    return m - format::one();
+}
+
+
+/*!
+ \brief Rounds \f$\ln(1 + t) + k \ln 2\f$ to the format R.
+ \param _ln_m \f$\ln(1 + t)\f$ with 60 fractional bits
+*/
+template<typename R>
+R sum_log(std::int64_t const _ln_m, std::int64_t const _k) {
+    using format = libq::details::polynomial_format;
+
+    enum: int {
+        output_fractional = static_cast<int>(R::bits_for_fractional) +
+            R::scaling_factor_exponent,
+
+        // |ln x| < 45 keeps 56 fractional bits in the 64-bit word
+        sum_fractional = (output_fractional + 2 < 56) ?
+            output_fractional + 2 : 56
+    };
+
+    std::int64_t const sum = (_ln_m >> (60 - sum_fractional)) +
+        libq::details::mulshift(_k, format::ln2(), 62 - sum_fractional);
+
+    return libq::details::round_to<R>(sum, sum_fractional);
+}
+
+
+/*!
+ \brief Computes the natural logarithm by the minimax polynomial.
+ \details The argument is normalized as \f$x = (1 + t) 2^k\f$ with
+ \f$1 + t \in [\frac{\sqrt{2}}{2}, \sqrt{2})\f$ by the leading bit position.
+ So \f$\ln x = t P(t) + k \ln 2\f$.
+ \note The absolute error is bounded by
+ \f$0.42\f$ libq::details::minimax<libq::functions::log, bits>::error_bound()
+ plus \f$2^{-55}\f$ and 0.5 ulp of the result format.
+*/
+template<>
+class log_impl<libq::engine::polynomial> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
+    static typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using log_type =
+            typename libq::details::log_of<T, n, f, e, op, up>::promoted_type;
+        using accuracy = libq::details::accuracy_class<static_cast<int>(f) + e>;  // NOLINT
+        using polynomial =
+            libq::details::minimax<libq::functions::log, accuracy::value>;
+
+        std::int64_t const x = static_cast<std::int64_t>(_val.value());
+        assert(("[libq::log] argument is not positive", x > 0));
+        if (x <= 0) {
+            throw std::logic_error("[libq::log]: argument is not positive");
+        }
+
+        std::int64_t k(0);
+        std::int64_t const t =
+            libq::details::reduce_log(x, static_cast<int>(f) + e, k);
+
+        return libq::details::sum_log<log_type>(
+            libq::details::mulshift(
+                t, libq::details::horner<polynomial>(t), 60u),
+            k);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_POLYNOMIAL_LOG_INL_
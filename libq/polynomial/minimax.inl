@@ -0,0 +1,841 @@
+// minimax.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file minimax.inl
+
+ Minimax polynomials of the reduced elementary functions. Generated by
+ scripts/minimax.py, do not edit.
+*/
+
+#ifndef INC_LIBQ_POLYNOMIAL_MINIMAX_INL_
+#define INC_LIBQ_POLYNOMIAL_MINIMAX_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Keeps the minimax polynomial of the reduced function.
+ \tparam Function tag of the function, see libq::functions
+ \tparam bits accuracy class: the absolute error of the polynomial is below
+ \f$2^{-(bits + 2)}\f$
+ \details Coefficients have 60 fractional bits, the constant term goes
+ first.
+*/
+template<class Function, std::size_t bits>
+class minimax;
+
+// sin(r) = r P(r^2), |r| <= pi/4
+template<>
+class minimax<libq::functions::sin, 16u> {
+ public:
+    enum: std::size_t { degree = 2u };
+
+    static double error_bound() { return 1.43e-6; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152919855260294925),
+            INT64_C(-192105317079532665),
+            INT64_C(9398195955418603)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::sin, 24u> {
+ public:
+    enum: std::size_t { degree = 3u };
+
+    static double error_bound() { return 3.07e-9; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921501063168461),
+            INT64_C(-192153400008902767),
+            INT64_C(9606184490695536),
+            INT64_C(-224866063908491)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::sin, 32u> {
+ public:
+    enum: std::size_t { degree = 4u };
+
+    static double error_bound() { return 4.32e-12; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504601868239),
+            INT64_C(-192153583697259816),
+            INT64_C(9607673962402598),
+            INT64_C(-228730439401310),
+            INT64_C(3132894990772)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::sin, 40u> {
+ public:
+    enum: std::size_t { degree = 5u };
+
+    static double error_bound() { return 4.28e-15; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606842047),
+            INT64_C(-192153584100565501),
+            INT64_C(9607679194163595),
+            INT64_C(-228754191387403),
+            INT64_C(3176906617205),
+            INT64_C(-28542410544)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::sin, 48u> {
+ public:
+    enum: std::size_t { degree = 6u };
+
+    static double error_bound() { return 3.53e-18; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846972),
+            INT64_C(-192153584101140587),
+            INT64_C(9607679205042113),
+            INT64_C(-228754266641642),
+            INT64_C(3177141920281),
+            INT64_C(-28881510588),
+            INT64_C(183253990)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::sin, 56u> {
+ public:
+    enum: std::size_t { degree = 7u };
+
+    static double error_bound() { return 2.46e-19; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846976),
+            INT64_C(-192153584101141162),
+            INT64_C(9607679205057044),
+            INT64_C(-228754266786884),
+            INT64_C(3177142593063),
+            INT64_C(-28883110336),
+            INT64_C(185140199),
+            INT64_C(-873695)
+        };
+        return values;
+    }
+};
+
+// cos(r) = P(r^2), |r| <= pi/4
+template<>
+class minimax<libq::functions::cos, 16u> {
+ public:
+    enum: std::size_t { degree = 3u };
+
+    static double error_bound() { return 2.76e-8; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921472813196877),
+            INT64_C(-576459100120264537),
+            INT64_C(48024976271797413),
+            INT64_C(-1566348608085104)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::cos, 24u> {
+ public:
+    enum: std::size_t { degree = 4u };
+
+    static double error_bound() { return 4.74e-11; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504552199075),
+            INT64_C(-576460747869675513),
+            INT64_C(48038338462853536),
+            INT64_C(-1601018191388880),
+            INT64_C(28108144858302)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::cos, 32u> {
+ public:
+    enum: std::size_t { degree = 4u };
+
+    static double error_bound() { return 4.74e-11; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504552199075),
+            INT64_C(-576460747869675513),
+            INT64_C(48038338462853536),
+            INT64_C(-1601018191388880),
+            INT64_C(28108144858302)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::cos, 40u> {
+ public:
+    enum: std::size_t { degree = 5u };
+
+    static double error_bound() { return 5.55e-14; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606782994),
+            INT64_C(-576460752295951157),
+            INT64_C(48038395883872057),
+            INT64_C(-1601278888608007),
+            INT64_C(28591219213383),
+            INT64_C(-313288938756)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::cos, 48u> {
+ public:
+    enum: std::size_t { degree = 6u };
+
+    static double error_bound() { return 4.74e-17; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846922),
+            INT64_C(-576460752303414858),
+            INT64_C(48038396025061362),
+            INT64_C(-1601279865330376),
+            INT64_C(28594273248641),
+            INT64_C(-317690221910),
+            INT64_C(2378532048)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::cos, 56u> {
+ public:
+    enum: std::size_t { degree = 7u };
+
+    static double error_bound() { return 1.3e-19; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846976),
+            INT64_C(-576460752303423481),
+            INT64_C(48038396025285044),
+            INT64_C(-1601279867506307),
+            INT64_C(28594283327977),
+            INT64_C(-317714188812),
+            INT64_C(2406790803),
+            INT64_C(-13089564)
+        };
+        return values;
+    }
+};
+
+// e^r = P(r), |r| <= ln(2)/2
+template<>
+class minimax<libq::functions::exp, 16u> {
+ public:
+    enum: std::size_t { degree = 4u };
+
+    static double error_bound() { return 2.62e-6; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921678787741157),
+            INT64_C(1152878018089533006),
+            INT64_C(576441910470821795),
+            INT64_C(193600398830123798),
+            INT64_C(48375938173917302)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::exp, 24u> {
+ public:
+    enum: std::size_t { degree = 6u };
+
+    static double error_bound() { return 1.87e-9; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504513571616),
+            INT64_C(1152921548116586566),
+            INT64_C(576460771716432168),
+            INT64_C(192150687652770269),
+            INT64_C(48037723855171627),
+            INT64_C(9655869075116599),
+            INT64_C(1609023385627109)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::exp, 32u> {
+ public:
+    enum: std::size_t { degree = 7u };
+
+    static double error_bound() { return 4.05e-11; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504560193743),
+            INT64_C(1152921504565402573),
+            INT64_C(576460764728412644),
+            INT64_C(192153587896252912),
+            INT64_C(48037879012446056),
+            INT64_C(9607581569135405),
+            INT64_C(1608162165658559),
+            INT64_C(229710029844516)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::exp, 40u> {
+ public:
+    enum: std::size_t { degree = 9u };
+
+    static double error_bound() { return 1.35e-14; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606862532),
+            INT64_C(1152921504606861112),
+            INT64_C(576460752296948978),
+            INT64_C(192153584099140517),
+            INT64_C(48038396456424080),
+            INT64_C(9607679286565949),
+            INT64_C(1601269819994894),
+            INT64_C(228752883791119),
+            INT64_C(28689833129003),
+            INT64_C(3187565534470)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::exp, 48u> {
+ public:
+    enum: std::size_t { degree = 10u };
+
+    static double error_bound() { return 2.13e-16; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846969),
+            INT64_C(1152921504606854752),
+            INT64_C(576460752303427080),
+            INT64_C(192153584099846596),
+            INT64_C(48038396024981327),
+            INT64_C(9607679265402716),
+            INT64_C(1601279877108573),
+            INT64_C(228753118723135),
+            INT64_C(28594144202112),
+            INT64_C(3186696217730),
+            INT64_C(318655099699)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::exp, 56u> {
+ public:
+    enum: std::size_t { degree = 12u };
+
+    static double error_bound() { return 1.22e-19; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846976),
+            INT64_C(1152921504606846974),
+            INT64_C(576460752303423487),
+            INT64_C(192153584101141575),
+            INT64_C(48038396025285388),
+            INT64_C(9607679205029613),
+            INT64_C(1601279867505136),
+            INT64_C(228754267570415),
+            INT64_C(28594283443075),
+            INT64_C(3177131726522),
+            INT64_C(317713196575),
+            INT64_C(28955472052),
+            INT64_C(2412889490)
+        };
+        return values;
+    }
+};
+
+// ln(1 + t) = t P(t), 1 + t in [sqrt(2)/2, sqrt(2)]
+template<>
+class minimax<libq::functions::log, 16u> {
+ public:
+    enum: std::size_t { degree = 6u };
+
+    static double error_bound() { return 1.12e-6; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152922516096649711),
+            INT64_C(-576476874949058832),
+            INT64_C(384107673021761824),
+            INT64_C(-287040431226774078),
+            INT64_C(235827162681732620),
+            INT64_C(-216550484409111743),
+            INT64_C(140783807359476922)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::log, 24u> {
+ public:
+    enum: std::size_t { degree = 9u };
+
+    static double error_bound() { return 4.12e-9; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921505375527310),
+            INT64_C(-576460617696814320),
+            INT64_C(384306811401241725),
+            INT64_C(-288248487882790085),
+            INT64_C(230621275592167744),
+            INT64_C(-191504211304322791),
+            INT64_C(163261946840308428),
+            INT64_C(-152326957463316384),
+            INT64_C(150100842995048719),
+            INT64_C(-90283513685186116)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::log, 32u> {
+ public:
+    enum: std::size_t { degree = 12u };
+
+    static double error_bound() { return 1.64e-11; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504589119599),
+            INT64_C(-576460752544253464),
+            INT64_C(384307180625127882),
+            INT64_C(-288230327641450350),
+            INT64_C(230582857368640744),
+            INT64_C(-192155625691178392),
+            INT64_C(164765578849611051),
+            INT64_C(-144114365278000109),
+            INT64_C(126875519615488820),
+            INT64_C(-114092623856315705),
+            INT64_C(115444404234188230),
+            INT64_C(-115413952426087555),
+            INT64_C(63568886205556557)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::log, 40u> {
+ public:
+    enum: std::size_t { degree = 15u };
+
+    static double error_bound() { return 6.82e-14; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606906614),
+            INT64_C(-576460752305769609),
+            INT64_C(384307168139991883),
+            INT64_C(-288230375294593474),
+            INT64_C(230584311109012756),
+            INT64_C(-192153679387914816),
+            INT64_C(164702480173335876),
+            INT64_C(-144110341252255218),
+            INT64_C(128117117415812880),
+            INT64_C(-115421123282074316),
+            INT64_C(104677381309422926),
+            INT64_C(-94247227346266405),
+            INT64_C(88112613291850953),
+            INT64_C(-94888198537139172),
+            INT64_C(93573669682433808),
+            INT64_C(-47255379446777757)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::log, 48u> {
+ public:
+    enum: std::size_t { degree = 18u };
+
+    static double error_bound() { return 2.93e-16; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606847041),
+            INT64_C(-576460752303405436),
+            INT64_C(384307168202180904),
+            INT64_C(-288230376160586335),
+            INT64_C(230584300952355906),
+            INT64_C(-192153582837148436),
+            INT64_C(164703068102326290),
+            INT64_C(-144115268002225712),
+            INT64_C(128102652078917613),
+            INT64_C(-115289537123645400),
+            INT64_C(104801413826054549),
+            INT64_C(-96122346588184680),
+            INT64_C(88888562911206731),
+            INT64_C(-81976586040419541),
+            INT64_C(74480597094155673),
+            INT64_C(-72391911809845841),
+            INT64_C(81794631738240559),
+            INT64_C(-78278233125699211),
+            INT64_C(36398920503212115)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::log, 56u> {
+ public:
+    enum: std::size_t { degree = 21u };
+
+    static double error_bound() { return 1.75e-18; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846975),
+            INT64_C(-576460752303423518),
+            INT64_C(384307168202285138),
+            INT64_C(-288230376151693650),
+            INT64_C(230584300920429575),
+            INT64_C(-192153584103968391),
+            INT64_C(164703072209882154),
+            INT64_C(-144115187926636280),
+            INT64_C(128102381142140473),
+            INT64_C(-115292150362413217),
+            INT64_C(104811363618162979),
+            INT64_C(-96077097127323077),
+            INT64_C(88678939405682110),
+            INT64_C(-82338477079272366),
+            INT64_C(76961439335613346),
+            INT64_C(-72320651310194848),
+            INT64_C(67097710549725888),
+            INT64_C(-61222559380160119),
+            INT64_C(62114184278273926),
+            INT64_C(-72657977951578791),
+            INT64_C(66828433482460755),
+            INT64_C(-28754434154521935)
+        };
+        return values;
+    }
+};
+
+// atan(s) = s P(s^2), |s| <= sqrt(2) - 1
+template<>
+class minimax<libq::functions::atan, 16u> {
+ public:
+    enum: std::size_t { degree = 3u };
+
+    static double error_bound() { return 5.41e-7; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152920880712305942),
+            INT64_C(-384186865764535896),
+            INT64_C(226934683834256703),
+            INT64_C(-128234679765033869)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::atan, 24u> {
+ public:
+    enum: std::size_t { degree = 5u };
+
+    static double error_bound() { return 5.88e-10; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921503929266570),
+            INT64_C(-384306877064719087),
+            INT64_C(230563988730590290),
+            INT64_C(-164180980526885372),
+            INT64_C(121930589744514112),
+            INT64_C(-69638593765489196)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::atan, 32u> {
+ public:
+    enum: std::size_t { degree = 6u };
+
+    static double error_bound() { return 2.02e-11; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504583596759),
+            INT64_C(-384307154645082194),
+            INT64_C(230583008591784570),
+            INT64_C(-164656666427536782),
+            INT64_C(127301164777662606),
+            INT64_C(-97560446130752954),
+            INT64_C(54402356408050737)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::atan, 40u> {
+ public:
+    enum: std::size_t { degree = 8u };
+
+    static double error_bound() { return 2.49e-14; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606818213),
+            INT64_C(-384307168174672193),
+            INT64_C(230584296556067148),
+            INT64_C(-164702805813134191),
+            INT64_C(128094220313669852),
+            INT64_C(-104669240151273663),
+            INT64_C(87220798759217671),
+            INT64_C(-67790174402574659),
+            INT64_C(35441245023702721)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::atan, 48u> {
+ public:
+    enum: std::size_t { degree = 10u };
+
+    static double error_bound() { return 3.25e-17; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846939),
+            INT64_C(-384307168202229103),
+            INT64_C(230584300908785223),
+            INT64_C(-164703070924952457),
+            INT64_C(128102334285931851),
+            INT64_C(-104809515331884960),
+            INT64_C(88659625122287049),
+            INT64_C(-76560759000075454),
+            INT64_C(65602362997163247),
+            INT64_C(-50184874767283264),
+            INT64_C(24431770780452697)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::atan, 56u> {
+ public:
+    enum: std::size_t { degree = 11u };
+
+    static double error_bound() { return 1.53e-18; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846975),
+            INT64_C(-384307168202280021),
+            INT64_C(230584300920720977),
+            INT64_C(-164703072015165931),
+            INT64_C(128102385318418008),
+            INT64_C(-104810908062863066),
+            INT64_C(88683308924347844),
+            INT64_C(-76819302006254584),
+            INT64_C(67414791571338052),
+            INT64_C(-58071925763812240),
+            INT64_C(43822810782019459),
+            INT64_C(-20583125918110243)
+        };
+        return values;
+    }
+};
+
+// tanh(r) = r P(r^2), |r| <= ln(2)/2
+template<>
+class minimax<libq::functions::tanh, 16u> {
+ public:
+    enum: std::size_t { degree = 2u };
+
+    static double error_bound() { return 2.66e-6; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152918441960245409),
+            INT64_C(-383840758028645893),
+            INT64_C(143137639011495891)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::tanh, 24u> {
+ public:
+    enum: std::size_t { degree = 4u };
+
+    static double error_bound() { return 3.75e-10; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504174491292),
+            INT64_C(-384306986471672356),
+            INT64_C(153710631323997829),
+            INT64_C(-61931516028681416),
+            INT64_C(22379360750055024)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::tanh, 32u> {
+ public:
+    enum: std::size_t { degree = 5u };
+
+    static double error_bound() { return 4.46e-12; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504601709513),
+            INT64_C(-384307165097725377),
+            INT64_C(153722563088571039),
+            INT64_C(-62210234112863602),
+            INT64_C(25035387981345385),
+            INT64_C(-8855595990842859)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::tanh, 40u> {
+ public:
+    enum: std::size_t { degree = 6u };
+
+    static double error_bound() { return 5.3e-14; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606785930),
+            INT64_C(-384307168152128754),
+            INT64_C(153722860550911514),
+            INT64_C(-62220821422656764),
+            INT64_C(25205640072114293),
+            INT64_C(-10117064568351980),
+            INT64_C(3504244379409686)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::tanh, 48u> {
+ public:
+    enum: std::size_t { degree = 7u };
+
+    static double error_bound() { return 6.3e-16; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846251),
+            INT64_C(-384307168201504613),
+            INT64_C(153722867144078137),
+            INT64_C(-62221151385950341),
+            INT64_C(25213500609623202),
+            INT64_C(-10213163544343087),
+            INT64_C(4086698902094619),
+            INT64_C(-1386665488711460)
+        };
+        return values;
+    }
+};
+
+template<>
+class minimax<libq::functions::tanh, 56u> {
+ public:
+    enum: std::size_t { degree = 9u };
+
+    static double error_bound() { return 1.78e-19; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+            INT64_C(1152921504606846976),
+            INT64_C(-384307168202282154),
+            INT64_C(153722867280865613),
+            INT64_C(-62221160561013883),
+            INT64_C(25213803351986528),
+            INT64_C(-10218606193910465),
+            INT64_C(4141276307093493),
+            INT64_C(-1676497195289468),
+            INT64_C(666003092296638),
+            INT64_C(-217133346147231)
+        };
+        return values;
+    }
+};
+
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_POLYNOMIAL_MINIMAX_INL_
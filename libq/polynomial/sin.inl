@@ -0,0 +1,72 @@
+// sin.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sin.inl
+
+ Provides the minimax polynomial engine for sin function
+*/
+
+#ifndef INC_LIBQ_POLYNOMIAL_SIN_INL_
+#define INC_LIBQ_POLYNOMIAL_SIN_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes \f$\sin r\f$ or \f$\cos r\f$ of the reduced angle
+ \f$r \in [-\frac{\pi}{4}, \frac{\pi}{4}]\f$ with 60 fractional bits.
+*/
+template<std::size_t bits>
+std::int64_t sin_or_cos(std::int64_t const _r, bool const _sin) {
+    using sin_polynomial = libq::details::minimax<libq::functions::sin, bits>;
+    using cos_polynomial = libq::details::minimax<libq::functions::cos, bits>;
+
+    std::int64_t const z = libq::details::mulshift(_r, _r, 60u);
+
+    return _sin ?
+        libq::details::mulshift(_r,
+                                libq::details::horner<sin_polynomial>(z),
+                                60u) :
+        libq::details::horner<cos_polynomial>(z);
+}
+
+
+/*!
+ \brief Computes the sine by the minimax polynomial.
+ \details The argument is reduced as \f$x = k\frac{\pi}{2} + r\f$, so
+ \f$\sin x\f$ is one of \f$\pm\sin r\f$ and \f$\pm\cos r\f$. Just one of the
+ polynomials is evaluated.
+ \note The absolute error is bounded by
+ libq::details::minimax<libq::functions::sin, bits>::error_bound() plus
+ \f$2^{-58}\f$ for the reduction and the evaluation and 0.5 ulp of the result
+ format, where bits is libq::details::accuracy_class of the result.
+*/
+template<>
+class sin_impl<libq::engine::polynomial> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using sin_type =
+            typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using work_type = libq::Q<63, 60, 0, op, up>;
+        using accuracy = libq::details::accuracy_class<static_cast<int>(f) + e>;  // NOLINT
+
+        work_type r(0);
+        int const quadrant = libq::details::reduce_angle(_val, r);
+
+        std::int64_t const y = libq::details::sin_or_cos<accuracy::value>(
+            static_cast<std::int64_t>(r.value()),
+            (quadrant & 1) == 0);
+
+        return libq::details::round_to<sin_type>((quadrant & 2) ? -y : y);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_POLYNOMIAL_SIN_INL_
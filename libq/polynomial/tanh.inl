@@ -0,0 +1,81 @@
+// tanh.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file tanh.inl
+
+ Provides the minimax polynomial engine for tanh function
+*/
+
+#ifndef INC_LIBQ_POLYNOMIAL_TANH_INL_
+#define INC_LIBQ_POLYNOMIAL_TANH_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the hyperbolic tangent by the minimax polynomials.
+ \details The argument is reduced as \f$x = k \ln 2 + r\f$.
+ 1. \f$\tanh x = r P(r^2)\f$ for \f$k = 0\f$.
+ 2. Otherwise \f$\tanh |x| = 1 - \frac{2E}{1 + E}\f$, where
+ \f$E = e^{-2|x|} = 2^{-2|k|} e^{\mp 2r} \leq \frac12\f$ is given by the
+ exponent's polynomial and the reciprocal is computed by
+ libq::details::reciprocal.
+ \note The absolute error is bounded by
+ libq::details::minimax<libq::functions::tanh, bits>::error_bound() and
+ \f$2 \sqrt{2}\f$ libq::details::minimax<libq::functions::exp, bits>::error_bound()
+ plus \f$2^{-57}\f$ and 0.5 ulp of the result format.
+*/
+template<>
+class tanh_impl<libq::engine::polynomial> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::tanh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using tanh_type =
+            typename libq::details::tanh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using format = libq::details::polynomial_format;
+        using work_type = libq::Q<63, 60, 0, op, up>;
+        using accuracy = libq::details::accuracy_class<static_cast<int>(f) + e>;  // NOLINT
+        using tanh_polynomial =
+            libq::details::minimax<libq::functions::tanh, accuracy::value>;
+        using exp_polynomial =
+            libq::details::minimax<libq::functions::exp, accuracy::value>;
+
+        work_type reduced(0);
+        std::int64_t const k =
+            libq::details::reduce<libq::details::ln2_constant>(_val, reduced);
+        std::int64_t const r = static_cast<std::int64_t>(reduced.value());
+
+        if (k == 0) {
+            std::int64_t const z = libq::details::mulshift(r, r, 60u);
+
+            return libq::details::round_to<tanh_type>(
+                libq::details::mulshift(
+                    r, libq::details::horner<tanh_polynomial>(z), 60u));
+        }
+
+        // E = 2^{-2|k|} (e^{-|r|})^2, where the sign of r follows x
+        bool const negative = (k < 0);
+        std::int64_t const q = libq::details::horner<exp_polynomial>(
+            negative ? r : -r);
+        std::int64_t const shift = 2 * (negative ? -k : k);
+        std::int64_t const exponent = (shift < 63) ?
+            (libq::details::mulshift(q, q, 60u) >> shift) : 0;
+
+        // 2 / (1 + E), where (1 + E) / 2 is from (0.5, 0.75]
+        std::int64_t const y = libq::details::reciprocal<60u>(
+            static_cast<std::uint64_t>(format::one() + exponent) << 3u);
+        std::int64_t const result =
+            format::one() - libq::details::mulshift(exponent, y, 60u);
+
+        return libq::details::round_to<tanh_type>(negative ? -result : result);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_POLYNOMIAL_TANH_INL_
@@ -0,0 +1,71 @@
+// atan.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file atan.inl
+
+ Provides the table engine for atan function
+*/
+
+#ifndef INC_LIBQ_TABLE_ATAN_INL_
+#define INC_LIBQ_TABLE_ATAN_INL_
+
+#include <cmath>
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the arctangent by the table with the linear interpolation.
+ \details The argument is reduced to \f$u = \min(|x|, \frac1{|x|})\f$ by
+ libq::details::reduce_atan, the table samples \f$\arctan u\f$ for
+ \f$u \in [0, 1]\f$.
+ \note The absolute error is bounded by
+ libq::details::interpolation_table::error_bound() and 0.5 ulp of the result
+ format.
+*/
+template<>
+class atan_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using atan_type =
+            typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using format = libq::details::polynomial_format;
+        using entries = libq::details::table_entries<static_cast<int>(f) + e>;  // NOLINT
+        using table_type =
+            libq::details::interpolation_table<entries::log2_value>;
+
+        static table_type const arctangents = table_type::sampled(
+            [](double _x) { return std::atan(_x); }, 0.0, 0);
+
+        std::int64_t const x = static_cast<std::int64_t>(_val.value());
+        if (x == 0) {
+            return atan_type(0);
+        }
+        bool const negative = (x < 0);
+        std::uint64_t const magnitude = negative ?
+            std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+            static_cast<std::uint64_t>(x);
+
+        bool inverted(false);
+        std::int64_t const u = libq::details::reduce_atan(
+            magnitude, static_cast<int>(f) + e, inverted);
+
+        // the last entry is out of the interpolation range
+        std::int64_t result = (u < format::one()) ?
+            arctangents(u, 60) : format::pi_4();
+        if (inverted) {
+            result = format::pi_2() - result;
+        }
+
+        return libq::details::round_to<atan_type>(negative ? -result : result);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_TABLE_ATAN_INL_
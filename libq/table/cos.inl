@@ -0,0 +1,49 @@
+// cos.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file cos.inl
+
+ Provides the table engine for cos function
+*/
+
+#ifndef INC_LIBQ_TABLE_COS_INL_
+#define INC_LIBQ_TABLE_COS_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the cosine by the table with the linear interpolation.
+ \note The error is bounded as for libq::details::sin_impl.
+*/
+template<>
+class cos_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using cos_type =
+            typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using work_type = libq::Q<63, 60, 0, op, up>;
+        using entries = libq::details::table_entries<static_cast<int>(f) + e>;  // NOLINT
+
+        work_type r(0);
+        int const quadrant = libq::details::reduce_angle(_val, r);
+
+        std::int64_t const y =
+            libq::details::interpolated_sin_or_cos<entries::log2_value>(
+                static_cast<std::int64_t>(r.value()),
+                (quadrant & 1) != 0);
+
+        return libq::details::round_to<cos_type>(
+            (quadrant == 1 || quadrant == 2) ? -y : y);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_TABLE_COS_INL_
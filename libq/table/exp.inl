@@ -0,0 +1,58 @@
+// exp.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file exp.inl
+
+ Provides the table engine for exp function
+*/
+
+#ifndef INC_LIBQ_TABLE_EXP_INL_
+#define INC_LIBQ_TABLE_EXP_INL_
+
+#include <cmath>
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the exponent by the table with the linear interpolation.
+ \details The argument is reduced as \f$x = k \ln 2 + r\f$, the table samples
+ \f$e^r\f$ for \f$r \in [-0.5, 0.5]\f$. The result is saturated if it
+ exceeds the format.
+ \note The relative error is bounded by \f$\sqrt{2}\f$
+ libq::details::interpolation_table::error_bound().
+*/
+template<>
+class exp_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using exp_type =
+            typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using format = libq::details::polynomial_format;
+        using work_type = libq::Q<63, 60, 0, op, up>;
+        using entries = libq::details::table_entries<static_cast<int>(f) + e>;  // NOLINT
+        using table_type =
+            libq::details::interpolation_table<entries::log2_value>;
+
+        static table_type const exponents = table_type::sampled(
+            [](double _x) { return std::exp(_x); }, -0.5, 0);
+
+        work_type r(0);
+        std::int64_t const k =
+            libq::details::reduce<libq::details::ln2_constant>(_val, r);
+
+        return libq::details::scale_exp<exp_type>(
+            exponents(static_cast<std::int64_t>(r.value()) + format::one() / 2,  // NOLINT
+                      60),
+            k);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_TABLE_EXP_INL_
@@ -0,0 +1,261 @@
+// interpolation.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file interpolation.inl
+
+ Provides the uniform tables of function values with the linear and the
+ cubic Hermite interpolation between entries
+*/
+
+#ifndef INC_LIBQ_TABLE_INTERPOLATION_INL_
+#define INC_LIBQ_TABLE_INTERPOLATION_INL_
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Gets the binary logarithm of the number of table entries for the
+ result with bits fractional bits.
+ \details The error of the linear interpolation is about
+ \f$\frac{h^2}{8} \max|g''|\f$ for the step \f$h\f$. So \f$2^{(bits + 4)/2}\f$
+ entries per unit interval keep it below a quarter of ulp. The table is
+ limited by 256 and 4096 entries.
+*/
+template<int bits>
+class table_entries {
+ public:
+    enum: std::size_t {
+        log2_value = ((bits + 4) / 2 < 8) ? 8u :
+                     ((bits + 4) / 2 > 12) ? 12u :
+                     static_cast<std::size_t>((bits + 4) / 2)
+    };
+};
+
+
+/*!
+ \brief Keeps the values of function \f$g\f$ at \f$a + i h\f$, where
+ \f$h = 2^{log2\_length - log2\_entries}\f$ and
+ \f$i = 0, 1, ..., 2^{log2\_entries}\f$.
+ \details Values have 60 fractional bits. The table is filled once per
+ format on the first call of the function.
+*/
+template<std::size_t log2_entries>
+class interpolation_table
+    : public std::array<std::int64_t, (std::size_t(1u) << log2_entries) + 1u> {  // NOLINT
+    using base_class =
+        std::array<std::int64_t, (std::size_t(1u) << log2_entries) + 1u>;
+    using this_class = interpolation_table<log2_entries>;
+
+    explicit interpolation_table(int const _log2_length)
+        : base_class(),
+          m_log2_length(_log2_length),
+          m_error(0.0) {
+    }
+
+ public:
+    enum: std::size_t {
+        entries = std::size_t(1u) << log2_entries  ///< number of intervals
+    };
+
+    /*!
+     \brief Samples the function on \f$[a, a + 2^{log2\_length}]\f$.
+    */
+    template<typename Function>
+    static this_class sampled(Function _g,
+                              double const _a,
+                              int const _log2_length) {
+        this_class table(_log2_length);
+
+        double const h = std::ldexp(1.0, _log2_length -
+                                         static_cast<int>(log2_entries));
+        for (std::size_t i = 0u; i != entries + 1u; ++i) {
+            table[i] = std::llround(std::ldexp(_g(_a + h * i), 60));
+        }
+
+        // the interpolation error is the largest about the middle points
+        for (std::size_t i = 0u; i != entries; ++i) {
+            double const middle = std::ldexp(
+                static_cast<double>(table[i]) + static_cast<double>(table[i + 1u]),  // NOLINT
+                -61);
+            double const error = std::fabs(middle - _g(_a + h * (i + 0.5)));
+            if (error > table.m_error) {
+                table.m_error = error;
+            }
+        }
+
+        return table;
+    }
+
+    /*!
+     \brief Interpolates the function at \f$x = a + u\f$.
+     \param _u offset from the left bound with _bits fractional bits, it must
+     be from \f$[0, 2^{log2\_length})\f$
+     \return the value with 60 fractional bits
+    */
+    std::int64_t operator()(std::int64_t const _u, int const _bits) const {
+        int const shift = _bits + m_log2_length - static_cast<int>(log2_entries);  // NOLINT
+
+        std::int64_t const index = _u >> shift;
+        std::int64_t const fraction = _u - (index << shift);
+        std::int64_t const left = (*this)[static_cast<std::size_t>(index)];
+        std::int64_t const right = (*this)[static_cast<std::size_t>(index) + 1u];  // NOLINT
+
+        return left + libq::details::mulshift(right - left,
+                                              fraction,
+                                              static_cast<std::size_t>(shift));  // NOLINT
+    }
+
+    /*!
+     \brief Gets the upper bound for the absolute error of the interpolation.
+    */
+    double error_bound() const {
+        return m_error + std::ldexp(1.0, -59);
+    }
+
+ private:
+    int m_log2_length;
+    double m_error;
+};
+
+
+/*!
+ \brief Gets the binary logarithm of the number of entries of
+ libq::details::hermite_table on \f$[a, a + 2^{log2\_length}]\f$ for the
+ result with bits fractional bits.
+ \details The error of the cubic Hermite interpolation is about
+ \f$\frac{h^4}{384} \max|g^{(4)}|\f$ for the step \f$h\f$, so
+ \f$2^{bits/4}\f$ entries per unit interval keep it below a quarter of ulp
+ for \f$|g^{(4)}| < 10\f$. The table is limited by 16 and 4096 entries.
+*/
+template<int bits, int log2_length>
+class hermite_entries {
+    enum: int { value_per_unit = ((bits < 8) ? 8 : bits) / 4 + log2_length };
+
+ public:
+    enum: std::size_t {
+        log2_value = (value_per_unit < 4) ? 4u :
+                     (value_per_unit > 12) ? 12u :
+                     static_cast<std::size_t>(value_per_unit)
+    };
+};
+
+
+/*!
+ \brief Keeps the values and the derivatives of function \f$g\f$ at
+ \f$a + i h\f$, where \f$h = 2^{log2\_length - log2\_entries}\f$ and
+ \f$i = 0, 1, ..., 2^{log2\_entries}\f$, and interpolates \f$g\f$ by the
+ cubic Hermite polynomials.
+ \details Values and derivatives multiplied by \f$h\f$ have 60 fractional
+ bits. The cubic interpolation needs far less entries than
+ libq::details::interpolation_table does, so the table suits the wide formats
+ as well.
+*/
+template<std::size_t log2_entries>
+class hermite_table {
+    using this_class = hermite_table<log2_entries>;
+    using column_type =
+        std::array<std::int64_t, (std::size_t(1u) << log2_entries) + 1u>;
+
+    explicit hermite_table(int const _log2_length)
+        : m_values(),
+          m_slopes(),
+          m_log2_length(_log2_length),
+          m_error(0.0) {
+    }
+
+ public:
+    enum: std::size_t {
+        entries = std::size_t(1u) << log2_entries  ///< number of intervals
+    };
+
+    /*!
+     \brief Samples the function _g and its derivative _dg on
+     \f$[a, a + 2^{log2\_length}]\f$.
+    */
+    template<typename Function, typename Derivative>
+    static this_class sampled(Function _g,
+                              Derivative _dg,
+                              double const _a,
+                              int const _log2_length) {
+        this_class table(_log2_length);
+
+        double const h = std::ldexp(1.0, _log2_length -
+                                         static_cast<int>(log2_entries));
+        for (std::size_t i = 0u; i != entries + 1u; ++i) {
+            table.m_values[i] = std::llround(std::ldexp(_g(_a + h * i), 60));
+            table.m_slopes[i] =
+                std::llround(std::ldexp(h * _dg(_a + h * i), 60));
+        }
+
+        // the interpolation error is the largest about the middle points:
+        // p(1/2) = (y0 + y1) / 2 + (d0 - d1) / 8
+        for (std::size_t i = 0u; i != entries; ++i) {
+            double const middle = std::ldexp(
+                4.0 * (static_cast<double>(table.m_values[i]) +
+                       static_cast<double>(table.m_values[i + 1u])) +
+                    static_cast<double>(table.m_slopes[i]) -
+                    static_cast<double>(table.m_slopes[i + 1u]),
+                -63);
+            double const error = std::fabs(middle - _g(_a + h * (i + 0.5)));
+            if (error > table.m_error) {
+                table.m_error = error;
+            }
+        }
+
+        return table;
+    }
+
+    /*!
+     \brief Interpolates the function at \f$x = a + u\f$.
+     \param _u offset from the left bound with _bits fractional bits, it must
+     be from \f$[0, 2^{log2\_length})\f$
+     \return the value with 60 fractional bits
+    */
+    std::int64_t operator()(std::int64_t const _u, int const _bits) const {
+        int const shift = _bits + m_log2_length - static_cast<int>(log2_entries);  // NOLINT
+
+        std::int64_t const index = _u >> shift;
+        std::int64_t const fraction = _u - (index << shift);
+        std::int64_t const t = (shift <= 60) ?
+            (fraction << (60 - shift)) : (fraction >> (shift - 60));
+
+        std::size_t const i = static_cast<std::size_t>(index);
+        std::int64_t const y0 = m_values[i];
+        std::int64_t const y1 = m_values[i + 1u];
+        std::int64_t const d0 = m_slopes[i];
+        std::int64_t const d1 = m_slopes[i + 1u];
+
+        // p(t) = y0 + t (d0 + t (c2 + t c3)) for t from [0, 1)
+        std::int64_t const c2 = 3 * (y1 - y0) - 2 * d0 - d1;
+        std::int64_t const c3 = 2 * (y0 - y1) + d0 + d1;
+
+        std::int64_t result = c2 + libq::details::mulshift(c3, t, 60u);
+        result = d0 + libq::details::mulshift(result, t, 60u);
+
+        return y0 + libq::details::mulshift(result, t, 60u);
+    }
+
+    /*!
+     \brief Gets the upper bound for the absolute error of the interpolation.
+    */
+    double error_bound() const {
+        return m_error + std::ldexp(1.0, -57);
+    }
+
+ private:
+    column_type m_values;
+    column_type m_slopes;
+
+    int m_log2_length;
+    double m_error;
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_TABLE_INTERPOLATION_INL_
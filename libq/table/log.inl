@@ -0,0 +1,64 @@
+// log.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file log.inl
+
+ Provides the table engine for log function
+*/
+
+#ifndef INC_LIBQ_TABLE_LOG_INL_
+#define INC_LIBQ_TABLE_LOG_INL_
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the natural logarithm by the table with the linear
+ interpolation.
+ \details The argument is normalized as \f$x = (1 + t) 2^k\f$, the table
+ samples \f$\ln(1 + t)\f$ for \f$t \in [-0.5, 0.5]\f$.
+ \note The absolute error is bounded by
+ libq::details::interpolation_table::error_bound() plus \f$2^{-55}\f$ and
+ 0.5 ulp of the result format.
+*/
+template<>
+class log_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, typename op, typename up>  // NOLINT
+    static typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using log_type =
+            typename libq::details::log_of<T, n, f, e, op, up>::promoted_type;
+        using format = libq::details::polynomial_format;
+        using entries = libq::details::table_entries<static_cast<int>(f) + e>;  // NOLINT
+        using table_type =
+            libq::details::interpolation_table<entries::log2_value>;
+
+        static table_type const logarithms = table_type::sampled(
+            [](double _x) { return std::log1p(_x); }, -0.5, 0);
+
+        std::int64_t const x = static_cast<std::int64_t>(_val.value());
+        assert(("[libq::log] argument is not positive", x > 0));
+        if (x <= 0) {
+            throw std::logic_error("[libq::log]: argument is not positive");
+        }
+
+        std::int64_t k(0);
+        std::int64_t const t =
+            libq::details::reduce_log(x, static_cast<int>(f) + e, k);
+
+        return libq::details::sum_log<log_type>(
+            logarithms(t + format::one() / 2, 60), k);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_TABLE_LOG_INL_
@@ -0,0 +1,73 @@
+// sin.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sin.inl
+
+ Provides the table engine for sin function
+*/
+
+#ifndef INC_LIBQ_TABLE_SIN_INL_
+#define INC_LIBQ_TABLE_SIN_INL_
+
+#include <cmath>
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Interpolates \f$\sin r\f$ or \f$\cos r\f$ of the reduced angle
+ \f$r \in [-\frac{\pi}{4}, \frac{\pi}{4}]\f$ with 60 fractional bits.
+ \details Both tables sample \f$[-1, 1]\f$.
+*/
+template<std::size_t log2_entries>
+std::int64_t interpolated_sin_or_cos(std::int64_t const _r, bool const _sin) {
+    using table_type = libq::details::interpolation_table<log2_entries>;
+    using format = libq::details::polynomial_format;
+
+    static table_type const sines = table_type::sampled(
+        [](double _x) { return std::sin(_x); }, -1.0, 1);
+    static table_type const cosines = table_type::sampled(
+        [](double _x) { return std::cos(_x); }, -1.0, 1);
+
+    std::int64_t const u = _r + format::one();
+    return _sin ? sines(u, 60) : cosines(u, 60);
+}
+
+
+/*!
+ \brief Computes the sine by the table with the linear interpolation.
+ \details The argument is reduced as \f$x = k\frac{\pi}{2} + r\f$, so
+ \f$\sin x\f$ is one of \f$\pm\sin r\f$ and \f$\pm\cos r\f$.
+ \note The absolute error is bounded by
+ libq::details::interpolation_table::error_bound() and 0.5 ulp of the result
+ format. The number of entries is given by libq::details::table_entries.
+*/
+template<>
+class sin_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using sin_type =
+            typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using work_type = libq::Q<63, 60, 0, op, up>;
+        using entries = libq::details::table_entries<static_cast<int>(f) + e>;  // NOLINT
+
+        work_type r(0);
+        int const quadrant = libq::details::reduce_angle(_val, r);
+
+        std::int64_t const y =
+            libq::details::interpolated_sin_or_cos<entries::log2_value>(
+                static_cast<std::int64_t>(r.value()),
+                (quadrant & 1) == 0);
+
+        return libq::details::round_to<sin_type>((quadrant & 2) ? -y : y);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_TABLE_SIN_INL_
@@ -0,0 +1,64 @@
+// sqrt.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sqrt.inl
+
+ Provides the table engine for sqrt function
+*/
+
+#ifndef INC_LIBQ_TABLE_SQRT_INL_
+#define INC_LIBQ_TABLE_SQRT_INL_
+
+#include <cmath>
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes square root by the table with the linear interpolation.
+ \details The argument is normalized as \f$x = m 4^k\f$ with
+ \f$m \in [1, 4)\f$, the table samples \f$\sqrt{m}\f$ for \f$m \in [1, 5]\f$.
+ So \f$\sqrt{x} = \sqrt{m} 2^k\f$.
+ \note The relative error is bounded by
+ libq::details::interpolation_table::error_bound().
+*/
+template<>
+class sqrt_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using sqrt_type =
+            typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type;
+        using format = libq::details::polynomial_format;
+        using entries = libq::details::table_entries<
+            static_cast<int>(sqrt_type::bits_for_fractional) +
+                sqrt_type::scaling_factor_exponent>;
+        using table_type =
+            libq::details::interpolation_table<entries::log2_value>;
+
+        static table_type const roots = table_type::sampled(
+            [](double _x) { return std::sqrt(_x); }, 1.0, 2);
+
+        std::int64_t const x = static_cast<std::int64_t>(_val.value());
+        if (x == 0) {
+            return sqrt_type(0);
+        }
+
+        // x is from [2^{p - f}, 2^{p - f + 1}), so the even power is 2k
+        int const p = libq::details::msb(x) - static_cast<int>(f) - e;
+        int const k = (p >= 0) ? (p / 2) : -((1 - p) / 2);
+        int const shift = 60 - static_cast<int>(f) - e - 2 * k;
+        std::int64_t const m = (shift >= 0) ? (x << shift) : (x >> (-shift));
+
+        return libq::details::round_to<sqrt_type>(
+            roots(m - format::one(), 60), 60 - k);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_TABLE_SQRT_INL_
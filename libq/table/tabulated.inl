@@ -0,0 +1,281 @@
+// tabulated.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file tabulated.inl
+
+ Provides the uniform tables of user-defined functions evaluated in integers
+*/
+
+#ifndef INC_LIBQ_TABLE_TABULATED_INL_
+#define INC_LIBQ_TABLE_TABULATED_INL_
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace libq {
+/*!
+ \brief Tags of the interpolation between the entries of libq::tabulated.
+*/
+namespace interpolation {
+/*!
+ \brief The value of the nearest entry.
+*/
+class nearest {
+};
+
+/*!
+ \brief The linear interpolation between two neighbouring entries.
+*/
+class linear {
+};
+
+/*!
+ \brief The quadratic interpolation by Newton's forward differences of three
+ neighbouring entries.
+*/
+class quadratic {
+};
+}  // namespace interpolation
+
+
+namespace details {
+/*!
+ \brief Gets the type of entries of libq::tabulated: the signed 64-bit
+ fixed-point number with up to 8 guard bits more than Q has.
+*/
+template<typename Q>
+class tabulated_value_of {
+    static_assert(Q::number_of_significant_bits <= 62u,
+                  "the differences of entries must fit 64 bits");
+
+    enum: std::size_t {
+        guard_bits = (Q::number_of_significant_bits + 8u <= 62u) ? 8u :
+            62u - Q::number_of_significant_bits
+    };
+
+ public:
+    using type = libq::fixed_point<std::int64_t,
+                                   Q::bits_for_integral,
+                                   Q::bits_for_fractional + guard_bits,
+                                   Q::scaling_factor_exponent,
+                                   typename Q::overflow_policy,
+                                   typename Q::underflow_policy>;
+};
+}  // namespace details
+
+
+/*!
+ \brief Keeps the user-defined function sampled over the whole range of the
+ fixed-point type Q_in and evaluates it by integer operations only.
+ \tparam Q_in fixed-point type of the argument
+ \tparam Q_out fixed-point type of the result
+ \tparam Func functor type: Func()(double) or the passed instance gives the
+ sampled values
+ \tparam Entries number of intervals between the samples, the power of two
+ \tparam Interp libq::interpolation::nearest, libq::interpolation::linear or
+ libq::interpolation::quadratic
+ \details The table is stored like libq::cordic::lut: it is the array of
+ Entries + 2 fixed-point numbers with up to 8 guard bits more than Q_out
+ has, see libq::details::tabulated_value_of. The index of the interval is
+ the high bits of the stored integer of the argument, the rest bits are the
+ offset within the interval. So the evaluation is the lookup, the
+ subtraction and one (linear) or three (quadratic) 64-bit integer
+ multiplications.
+
+ The table is sampled once by the constructor, error_bound() reports the
+ largest error of the evaluation measured at 8 points per interval.
+
+ <B>Usage</B>
+ \code{.cpp}
+    class gamma_correction {
+     public:
+        double operator()(double _x) const { return std::pow(_x, 1.0 / 2.2); }  // NOLINT
+    };
+
+    using curve_type = libq::tabulated<libq::UQ<12, 12>,
+                                       libq::UQ<16, 15>,
+                                       gamma_correction,
+                                       256u,
+                                       libq::interpolation::quadratic>;
+    static curve_type const curve;
+
+    libq::UQ<16, 15> const y = curve(libq::UQ<12, 12>(0.25));
+    double const max_error = curve.error_bound();
+ \endcode
+*/
+template<typename Q_in,
+         typename Q_out,
+         class Func,
+         std::size_t Entries = 256u,
+         class Interp = libq::interpolation::linear>
+class tabulated
+    : public std::array<typename libq::details::tabulated_value_of<Q_out>::type,  // NOLINT
+                        Entries + 2u> {
+ public:
+    using argument_type = Q_in;
+    using result_type = Q_out;
+    using value_type =
+        typename libq::details::tabulated_value_of<Q_out>::type;
+
+ private:
+    using base_class = std::array<value_type, Entries + 2u>;
+    using this_class = tabulated<Q_in, Q_out, Func, Entries, Interp>;
+
+    enum: std::size_t {
+        guard_bits = value_type::bits_for_fractional -
+            Q_out::bits_for_fractional,
+
+        // the argument offset from the minimum has argument_bits bits
+        argument_bits = Q_in::number_of_significant_bits +
+            (Q_in::is_signed ? 1u : 0u),
+        log2_entries = boost::static_log2<Entries>::value,
+        shift = argument_bits - log2_entries
+    };
+    enum: int {
+        argument_fractional = static_cast<int>(Q_in::bits_for_fractional) +
+            Q_in::scaling_factor_exponent,
+        value_fractional = static_cast<int>(value_type::bits_for_fractional) +
+            value_type::scaling_factor_exponent
+    };
+
+    static_assert(Entries >= 2u && (Entries & (Entries - 1u)) == 0u,
+                  "the number of entries must be the power of two");
+    static_assert(log2_entries <= argument_bits && argument_bits <= 63u,
+                  "the table has more entries than the argument values");
+
+ public:
+    enum: std::size_t {
+        entries = Entries  ///< number of intervals
+    };
+
+    explicit tabulated(Func const& _func = Func())
+        : base_class(),
+          m_error(0.0) {
+        // the last entry is the node beyond the maximum of Q_in: it gives
+        // the right point of the quadratic interpolation on the last
+        // interval
+        for (std::size_t i = 0u; i != Entries + 2u; ++i) {
+            (*this)[i] = value_type::wrap(static_cast<std::int64_t>(
+                std::llround(std::ldexp(_func(this_class::node(i)),
+                                        value_fractional))));
+        }
+
+        // the error is measured on the stored integers of the argument
+        std::uint64_t const step = (std::uint64_t(1u) << shift) / 8u;
+        for (std::size_t i = 0u; i != Entries; ++i) {
+            for (std::size_t j = 0u; j != 8u; ++j) {
+                std::uint64_t const u = (static_cast<std::uint64_t>(i) << shift) +  // NOLINT
+                    j * ((step > 0u) ? step : 1u);
+                if (u >> shift != i) {
+                    break;
+                }
+
+                double const x = std::ldexp(
+                    static_cast<double>(this_class::lowest() +
+                                        static_cast<std::int64_t>(u)),
+                    -argument_fractional);
+                double const error = std::fabs(
+                    static_cast<double>(this->evaluate(u)) - _func(x));
+                if (error > m_error) {
+                    m_error = error;
+                }
+            }
+        }
+    }
+
+    /*!
+     \brief Evaluates the function.
+    */
+    result_type operator()(argument_type const _x) const {
+        std::uint64_t const u =
+            static_cast<std::uint64_t>(static_cast<std::int64_t>(_x.value()) -  // NOLINT
+                                       this_class::lowest());
+
+        return this->evaluate(u);
+    }
+
+    /*!
+     \brief Gets the largest absolute error of the evaluation.
+     \details It is measured by the constructor at 8 points per interval,
+     the rounding of the entries and of the result is included.
+    */
+    double error_bound() const { return m_error; }
+
+ private:
+    static std::int64_t lowest() {
+        return static_cast<std::int64_t>(
+            std::numeric_limits<argument_type>::min().value());
+    }
+
+    static double node(std::size_t const _i) {
+        return std::ldexp(
+            static_cast<double>(this_class::lowest()) +
+                std::ldexp(static_cast<double>(_i), static_cast<int>(shift)),
+            -argument_fractional);
+    }
+
+    /*!
+     \brief Evaluates the function at the offset from the lowest argument.
+    */
+    result_type evaluate(std::uint64_t const _u) const {
+        std::int64_t const value = this->interpolate(_u, Interp());
+
+        std::int64_t const rounded = (guard_bits > 0u) ?
+            (value + (std::int64_t(1) << (guard_bits - 1u))) >> guard_bits :
+            value;
+        return result_type::wrap(
+            static_cast<typename result_type::storage_type>(rounded));
+    }
+
+    std::int64_t interpolate(std::uint64_t const _u,
+                             libq::interpolation::nearest) const {
+        std::size_t const index = static_cast<std::size_t>(
+            (shift > 0u) ?
+                (_u + (std::uint64_t(1u) << (shift - 1u))) >> shift : _u);
+
+        return (*this)[index].value();
+    }
+
+    std::int64_t interpolate(std::uint64_t const _u,
+                             libq::interpolation::linear) const {
+        std::size_t const index = static_cast<std::size_t>(_u >> shift);
+        std::int64_t const fraction = static_cast<std::int64_t>(
+            _u - (static_cast<std::uint64_t>(index) << shift));
+
+        std::int64_t const left = (*this)[index].value();
+        std::int64_t const right = (*this)[index + 1u].value();
+
+        return left + libq::details::mulshift(right - left, fraction, shift);
+    }
+
+    std::int64_t interpolate(std::uint64_t const _u,
+                             libq::interpolation::quadratic) const {
+        std::size_t const index = static_cast<std::size_t>(_u >> shift);
+        std::int64_t const t = static_cast<std::int64_t>(
+            _u - (static_cast<std::uint64_t>(index) << shift));
+
+        // p(t) = y0 + t d1 + t (t - 1) d2 / 2, t is scaled by 2^shift
+        std::int64_t const y0 = (*this)[index].value();
+        std::int64_t const y1 = (*this)[index + 1u].value();
+        std::int64_t const y2 = (*this)[index + 2u].value();
+        std::int64_t const d1 = y1 - y0;
+        std::int64_t const d2 = y2 - 2 * y1 + y0;
+
+        std::int64_t const one = std::int64_t(1) << shift;
+        std::int64_t const curvature = libq::details::mulshift(
+            libq::details::mulshift(d2, t, shift), t - one, shift);
+
+        return y0 + libq::details::mulshift(d1, t, shift) + curvature / 2;
+    }
+
+    double m_error;
+};
+}  // namespace libq
+
+#endif  // INC_LIBQ_TABLE_TABULATED_INL_
@@ -0,0 +1,69 @@
+// tanh.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file tanh.inl
+
+ Provides the table engine for tanh function
+*/
+
+#ifndef INC_LIBQ_TABLE_TANH_INL_
+#define INC_LIBQ_TABLE_TANH_INL_
+
+#include <cmath>
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \brief Computes the hyperbolic tangent by the table with the linear
+ interpolation.
+ \details The table samples \f$\tanh |x|\f$ for \f$|x| \in [0, 8]\f$, the
+ larger arguments give \f$\pm 1\f$.
+ \note The absolute error is bounded by
+ libq::details::interpolation_table::error_bound() plus
+ \f$1 - \tanh 8 < 2^{-21}\f$ and 0.5 ulp of the result format.
+*/
+template<>
+class tanh_impl<libq::engine::table> {
+ public:
+    template<typename T, std::size_t n, std::size_t f, int e, class op, class up>  // NOLINT
+    static typename libq::details::tanh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+        apply(libq::fixed_point<T, n, f, e, op, up> const& _val) {
+        using tanh_type =
+            typename libq::details::tanh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+        using format = libq::details::polynomial_format;
+        using entries = libq::details::table_entries<static_cast<int>(f) + e>;  // NOLINT
+        using table_type =
+            libq::details::interpolation_table<entries::log2_value>;
+
+        enum: int { input_fractional = static_cast<int>(f) + e };
+
+        static table_type const tangents = table_type::sampled(
+            [](double _x) { return std::tanh(_x); }, 0.0, 3);
+
+        std::int64_t const x = static_cast<std::int64_t>(_val.value());
+        bool const negative = (x < 0);
+        std::uint64_t const magnitude = negative ?
+            std::uint64_t(0u) - static_cast<std::uint64_t>(x) :
+            static_cast<std::uint64_t>(x);
+
+        // |x| with 56 fractional bits is below 2^{59}
+        std::int64_t result = format::one();
+        if (libq::details::msb(magnitude | 1u) < input_fractional + 3) {
+            std::int64_t const u = (input_fractional <= 56) ?
+                static_cast<std::int64_t>(magnitude << (56 - input_fractional)) :  // NOLINT
+                static_cast<std::int64_t>(magnitude >> (input_fractional - 56));  // NOLINT
+
+            result = tangents(u, 56);
+        }
+
+        return libq::details::round_to<tanh_type>(negative ? -result : result);
+    }
+};
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_TABLE_TANH_INL_
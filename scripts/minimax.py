@@ -0,0 +1,227 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+# Distributed under the New BSD License. (See accompanying file LICENSE)
+
+"""Generates libq/polynomial/minimax.inl.
+
+Finds the minimax polynomials of the reduced elementary functions by the Remez
+exchange algorithm for every accuracy class. The coefficients are rounded to
+the 64-bit integers with 60 fractional bits. The degree is the least one that
+keeps the error of the rounded polynomial below 2^{-(bits + 2)}.
+
+Usage: python minimax.py > ../libq/polynomial/minimax.inl
+Requires mpmath.
+"""
+
+import sys
+
+import mpmath
+from mpmath import mp, mpf
+
+mp.dps = 40
+
+WORK_BITS = 60
+CLASSES = (16, 24, 32, 40, 48, 56)
+GRID = 1000
+
+
+def _ratio(func):
+    """Gets func(sqrt(z)) / sqrt(z) with the limit at zero."""
+    def g(z):
+        if z == 0:
+            return mpf(1)
+        s = mpmath.sqrt(z)
+        return func(s) / s
+    return g
+
+
+def _log1p_ratio(t):
+    if t == 0:
+        return mpf(1)
+    return mpmath.log1p(t) / t
+
+
+# name, approximated function, interval, the comment of the reduced function
+FUNCTIONS = (
+    ('sin', _ratio(mpmath.sin), (mpf(0), (mp.pi / 4) ** 2),
+     'sin(r) = r P(r^2), |r| <= pi/4'),
+    ('cos', lambda z: mpmath.cos(mpmath.sqrt(z)), (mpf(0), (mp.pi / 4) ** 2),
+     'cos(r) = P(r^2), |r| <= pi/4'),
+    ('exp', mpmath.exp, (-mpmath.log(2) / 2, mpmath.log(2) / 2),
+     'e^r = P(r), |r| <= ln(2)/2'),
+    ('log', _log1p_ratio, (mpmath.sqrt(2) / 2 - 1, mpmath.sqrt(2) - 1),
+     'ln(1 + t) = t P(t), 1 + t in [sqrt(2)/2, sqrt(2)]'),
+    ('atan', _ratio(mpmath.atan), (mpf(0), (mpmath.sqrt(2) - 1) ** 2),
+     'atan(s) = s P(s^2), |s| <= sqrt(2) - 1'),
+    ('tanh', _ratio(mpmath.tanh), (mpf(0), (mpmath.log(2) / 2) ** 2),
+     'tanh(r) = r P(r^2), |r| <= ln(2)/2'),
+)
+
+
+def _evaluate(coefficients, x):
+    result = mpf(0)
+    for c in reversed(coefficients):
+        result = result * x + c
+    return result
+
+
+def _solve(matrix, rhs):
+    return list(mpmath.lu_solve(mpmath.matrix(matrix), mpmath.matrix(rhs)))
+
+
+def _extrema(error, a, b):
+    """Gets the alternating extrema of the error function on the grid."""
+    points = [a + (b - a) * i / GRID for i in range(GRID + 1)]
+    values = [error(x) for x in points]
+
+    extrema = []
+    for i in range(GRID + 1):
+        left = values[i - 1] if i > 0 else None
+        right = values[i + 1] if i < GRID else None
+        v = values[i]
+        is_max = (left is None or abs(v) >= abs(left)) and \
+                 (right is None or abs(v) >= abs(right))
+        if is_max and v != 0:
+            extrema.append((points[i], v))
+
+    # merges the neighbours of the same sign keeping the largest one
+    alternating = []
+    for x, v in extrema:
+        if alternating and (alternating[-1][1] > 0) == (v > 0):
+            if abs(v) > abs(alternating[-1][1]):
+                alternating[-1] = (x, v)
+        else:
+            alternating.append((x, v))
+    return alternating
+
+
+def remez(func, interval, degree, iterations=20):
+    a, b = interval
+    n = degree + 2
+    reference = [(a + b) / 2 - (b - a) / 2 * mpmath.cos(mp.pi * i / (n - 1))
+                 for i in range(n)]
+
+    coefficients = None
+    for _ in range(iterations):
+        matrix = [[x ** j for j in range(degree + 1)] + [(-1) ** i]
+                  for i, x in enumerate(reference)]
+        solution = _solve(matrix, [func(x) for x in reference])
+        coefficients = solution[:degree + 1]
+
+        def error(x):
+            return func(x) - _evaluate(coefficients, x)
+
+        extrema = _extrema(error, a, b)
+        if len(extrema) < n:
+            break
+        # keeps n consecutive extrema containing the largest one
+        largest = max(range(len(extrema)), key=lambda i: abs(extrema[i][1]))
+        start = min(largest, len(extrema) - n)
+        reference = [x for x, _ in extrema[start:start + n]]
+
+        # stops when the error equioscillates
+        levels = [abs(v) for _, v in extrema[start:start + n]]
+        if max(levels) - min(levels) <= max(levels) * mpf('1e-3'):
+            break
+
+    return coefficients
+
+
+def max_error(func, interval, coefficients):
+    a, b = interval
+    return max(abs(func(x) - _evaluate(coefficients, x))
+               for x in (a + (b - a) * i / GRID for i in range(GRID + 1)))
+
+
+def quantize(coefficients):
+    return [int(mpmath.nint(c * 2 ** WORK_BITS)) for c in coefficients]
+
+
+def main():
+    out = sys.stdout
+    out.write(HEADER)
+    for name, func, interval, comment in FUNCTIONS:
+        out.write('// %s\r\n' % comment)
+        degree = 1
+        for bits in CLASSES:
+            target = mpf(2) ** (-(bits + 2))
+            while True:
+                quantized = quantize(remez(func, interval, degree))
+                real = [mpf(c) / 2 ** WORK_BITS for c in quantized]
+                error = max_error(func, interval, real)
+                if error <= target:
+                    break
+                degree += 1
+
+            out.write(SPECIALIZATION % {
+                'name': name,
+                'bits': bits,
+                'degree': degree,
+                'error': mpmath.nstr(error, 3, min_fixed=1, max_fixed=0),
+                'coefficients': ',\r\n'.join(
+                    '            INT64_C(%d)' % c for c in quantized)})
+    out.write(FOOTER)
+
+
+HEADER = '''\
+// minimax.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \\file minimax.inl
+
+ Minimax polynomials of the reduced elementary functions. Generated by
+ scripts/minimax.py, do not edit.
+*/
+
+#ifndef INC_LIBQ_POLYNOMIAL_MINIMAX_INL_
+#define INC_LIBQ_POLYNOMIAL_MINIMAX_INL_
+
+#include <cstdint>
+
+namespace libq {
+namespace details {
+/*!
+ \\brief Keeps the minimax polynomial of the reduced function.
+ \\tparam Function tag of the function, see libq::functions
+ \\tparam bits accuracy class: the absolute error of the polynomial is below
+ \\f$2^{-(bits + 2)}\\f$
+ \\details Coefficients have 60 fractional bits, the constant term goes
+ first.
+*/
+template<class Function, std::size_t bits>
+class minimax;
+
+'''.replace('\n', '\r\n')
+
+SPECIALIZATION = '''\
+template<>
+class minimax<libq::functions::%(name)s, %(bits)du> {
+ public:
+    enum: std::size_t { degree = %(degree)du };
+
+    static double error_bound() { return %(error)s; }
+
+    static std::int64_t const* coefficients() {
+        static std::int64_t const values[degree + 1u] = {
+%(coefficients)s
+        };
+        return values;
+    }
+};
+
+'''.replace('\n', '\r\n')
+
+FOOTER = '''\
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_POLYNOMIAL_MINIMAX_INL_
+'''.replace('\n', '\r\n')
+
+
+if __name__ == '__main__':
+    main()
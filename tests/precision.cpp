@@ -12,6 +12,7 @@
 
 #include "libq/fixed_point.hpp"
 
+#include <algorithm>
 #include <ctime>
 
 #include <iomanip>
@@ -19,6 +20,23 @@
 #include <sstream>
 
 #include <stdexcept>
+#include <vector>
+
+// the engines selected per type, see engine_of_override
+namespace libq {
+template<class Function>
+class engine_of<libq::Q<14, 11>, Function>
+{
+public:
+    using type = libq::engine::table;
+};
+template<>
+class engine_of<libq::Q<22, 18>, libq::functions::sqrt>
+{
+public:
+    using type = libq::engine::cordic;
+};
+}
 
 namespace libq {
 namespace unit_tests {
@@ -290,7 +308,979 @@ BOOST_AUTO_TEST_CASE(precision_of_log)
     test_the_precision_of<UQ<32, 16> >(op, error(1E-3), custom_log);
     test_the_precision_of<UQ<43, 20> >(op, error(1E-4), custom_log);
     test_the_precision_of<UQ<50, 13> >(op, error(1E-2), custom_log);
+#undef error
+}
+class exp_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::exp(_x)); }
+    double operator()(double _x, double _y) const{ return std::exp(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_exp)
+{
+    logger custom_log("exp.log");
+
+    using Q1 = libq::Q<20, 16>;
+    using Q2 = libq::Q<34, 30>;
+
+    // the error is relative to the result, the formats keep e^x in 64 bits
+#define error(Q) [](double, double, double _a, double){ \
+    return libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() * std::max(1.0, std::exp(_a)) + Q::precision(); \
+}
+    test_the_precision_of<Q1>(exp_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(exp_op(), error(Q2), custom_log);
+#undef error
+
+    // the results below the half of ulp underflow to zero, the large ones raise the overflow or saturate
+    using Q3 = libq::Q<31, 20, 0, libq::overflow_exception_policy>;
+    using Q4 = libq::Q<31, 20>;
+    using exp_type = libq::details::exp_of<Q4>::promoted_type;
+
+    BOOST_CHECK_CLOSE(static_cast<double>(std::exp(Q3(30.0))), std::exp(30.0), 1e-4);
+    BOOST_CHECK_EQUAL(std::exp(Q3(-15.0)).value(), 0u);
+    BOOST_CHECK_EQUAL(std::exp(Q3(-100.0)).value(), 0u);
+    BOOST_CHECK_THROW(std::exp(Q3(40.0)), std::overflow_error);
+    BOOST_CHECK_THROW(std::exp(Q3(100.0)), std::overflow_error);
+    BOOST_CHECK_EQUAL(std::exp(Q4(50.0)).value(), libq::details::largest_stored<exp_type>());
+    BOOST_CHECK_EQUAL(std::exp(Q4(1000.0)).value(), libq::details::largest_stored<exp_type>());
+}
+class exp2_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::exp2(_x)); }
+    double operator()(double _x, double _y) const{ return std::exp2(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_exp2)
+{
+    logger custom_log("exp2.log");
+
+    using Q1 = libq::Q<20, 16>;
+    using Q2 = libq::Q<40, 36>;
+    using Q3 = libq::Q<31, 20, 0, libq::overflow_exception_policy>;
+
+    // the error is relative to the result, the rounding of the argument is amplified by the slope
+#define error(Q) [](double _u, double, double _a, double){ \
+    return libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() * std::max(1.0, std::exp2(_a)) + Q::precision() + std::fabs(std::exp2(_u) - std::exp2(_a)); \
+}
+    test_the_precision_of<Q1>(exp2_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(exp2_op(), error(Q2), custom_log);
+#undef error
+
+    // the results below the half of ulp underflow to zero, the large ones raise the overflow
+    BOOST_CHECK_SMALL(static_cast<double>(std::exp2(Q3(-19.5))) - std::exp2(-19.5), Q3::precision());
+    BOOST_CHECK_EQUAL(std::exp2(Q3(-63.5)).value(), 0u);
+    BOOST_CHECK_EQUAL(std::exp2(Q3(-2000.0)).value(), 0u);
+    BOOST_CHECK_THROW(std::exp2(Q3(1000.0)), std::overflow_error);
+}
+class log2_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::log2(_x)); }
+    double operator()(double _x, double _y) const{ return std::log2(_x); }
+};
+class log10_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::log10(_x)); }
+    double operator()(double _x, double _y) const{ return std::log10(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_log2)
+{
+    logger custom_log("log2.log");
+
+    using Q1 = libq::UQ<31, 28>;
+    using Q2 = libq::UQ<40, 36>;
+
+    // the logarithm is rounded, the rounding of the argument is amplified by the slope near zero
+#define error(Q, log) [](double _u, double, double _a, double){ \
+    return libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() + Q::precision() + std::fabs(log(_u) - log(_a)); \
+}
+    test_the_precision_of<Q1>(log2_op(), error(Q1, std::log2), custom_log);
+    test_the_precision_of<Q2>(log2_op(), error(Q2, std::log2), custom_log);
+    test_the_precision_of<Q1>(log10_op(), error(Q1, std::log10), custom_log);
+    test_the_precision_of<Q2>(log10_op(), error(Q2, std::log10), custom_log);
+#undef error
+}
+template<typename Q>
+void check_pow(double _x, double _y)
+{
+    using R = typename libq::details::pow_of<Q>::promoted_type;
+
+    Q const x(_x), y(_y);
+    double const expected = std::pow(static_cast<double>(x), static_cast<double>(y));
+    double const error = libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() * std::max(1.0, std::fabs(expected)) + R::precision();
+
+    BOOST_CHECK_SMALL(static_cast<double>(std::pow(x, y)) - expected, error);
+}
+BOOST_AUTO_TEST_CASE(precision_of_pow)
+{
+    using Q1 = libq::Q<31, 20>;
+    using Q2 = libq::Q<40, 36>;
+    using Q3 = libq::Q<31, 20, 0, libq::overflow_exception_policy>;
+
+    // the error is relative to the result like the one of exp2
+    for (int i = 1; i != 40; ++i) {
+        for (int j = -20; j != 20; ++j) {
+            check_pow<Q1>(0.1 * i + 0.05, 0.23 * j);
+            check_pow<Q2>(0.1 * i + 0.05, 0.23 * j);
+        }
+    }
+
+    // the integer exponents go to the fast path by squaring, the negative base is allowed for them
+    check_pow<Q1>(-1.5, 7.0);
+    check_pow<Q1>(-1.5, -3.0);
+    check_pow<Q2>(3.25, 5.0);
+    BOOST_CHECK_EQUAL(static_cast<double>(std::pow(Q1(-2.0), 3)), -8.0);
+    BOOST_CHECK_EQUAL(static_cast<double>(std::pow(Q1(2.0), -3)), 0.125);
+
+    // the results below the half of ulp underflow to zero, the large ones raise the overflow
+    BOOST_CHECK_EQUAL(std::pow(Q1(2.0), Q1(-1407.0)).value(), 0);
+    BOOST_CHECK_EQUAL(std::pow(Q1(2.0), Q1(-63.5)).value(), 0);
+    BOOST_CHECK_THROW(std::pow(Q3(3.0), Q3(300.5)), std::overflow_error);
+
+    // the products of the integer powers raise the overflow or saturate like the non-integer ones
+    using Q4 = libq::Q<31, 28, 0, libq::overflow_exception_policy>;
+    using Q5 = libq::Q<31, 28>;
+    using pow_type = libq::details::pow_of<Q5>::promoted_type;
+
+    BOOST_CHECK_CLOSE(static_cast<double>(std::pow(Q4(3.0), 22)), std::pow(3.0, 22), 1e-6);
+    BOOST_CHECK_THROW(std::pow(Q4(3.0), 23), std::overflow_error);
+    BOOST_CHECK_THROW(std::pow(Q4(3.0), 40), std::overflow_error);
+    BOOST_CHECK_THROW(std::pow(Q4(7.5), 13), std::overflow_error);
+    BOOST_CHECK_THROW(std::pow(Q3(3.0), Q3(40.0)), std::overflow_error);
+    BOOST_CHECK_EQUAL(std::pow(Q5(3.0), 40).value(), static_cast<std::int64_t>(libq::details::largest_stored<pow_type>()));
+    BOOST_CHECK_EQUAL(std::pow(Q5(-3.0), 41).value(), -static_cast<std::int64_t>(libq::details::largest_stored<pow_type>()));
+    BOOST_CHECK_EQUAL(static_cast<double>(std::pow(Q5(0.5), 20)), std::pow(0.5, 20));
+}
+class cbrt_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::cbrt(_x)); }
+    double operator()(double _x, double _y) const{ return std::cbrt(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_cbrt)
+{
+    logger custom_log("cbrt.log");
+
+    using Q1 = libq::Q<31, 20>;
+    using Q2 = libq::Q<40, 36>;
+
+    // the error is relative to the result, the rounding of the argument is amplified by the slope near zero
+#define error(Q) [](double _u, double, double _a, double){ \
+    return libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() * std::max(1.0, std::fabs(std::cbrt(_a))) + Q::precision() + std::fabs(std::cbrt(_u) - std::cbrt(_a)); \
 }
+    test_the_precision_of<Q1>(cbrt_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(cbrt_op(), error(Q2), custom_log);
+#undef error
+}
+class sinh_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::sinh(_x)); }
+    double operator()(double _x, double _y) const{ return std::sinh(_x); }
+};
+class cosh_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::cosh(_x)); }
+    double operator()(double _x, double _y) const{ return std::cosh(_x); }
+};
+class tanh_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::tanh(_x)); }
+    double operator()(double _x, double _y) const{ return std::tanh(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_hyperbolic)
+{
+    logger custom_log("hyperbolic.log");
+
+    using Q1 = libq::Q<15, 12>;
+    using Q2 = libq::Q<31, 28>;
+    using Q3 = libq::Q<40, 36>;
+
+    // the error of sinh and cosh is relative to cosh, the rounding of the argument is amplified by the slope
+#define error(Q, function) [](double _u, double, double _a, double){ \
+    return libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() * std::cosh(_a) + Q::precision() + std::fabs(function(_u) - function(_a)); \
+}
+    test_the_precision_of<Q1>(sinh_op(), error(Q1, std::sinh), custom_log);
+    test_the_precision_of<Q2>(sinh_op(), error(Q2, std::sinh), custom_log);
+    test_the_precision_of<Q3>(sinh_op(), error(Q3, std::sinh), custom_log);
+    test_the_precision_of<Q1>(cosh_op(), error(Q1, std::cosh), custom_log);
+    test_the_precision_of<Q2>(cosh_op(), error(Q2, std::cosh), custom_log);
+    test_the_precision_of<Q3>(cosh_op(), error(Q3, std::cosh), custom_log);
+#undef error
+
+    // the error of tanh is absolute
+#define error(Q) [](double _u, double, double _a, double){ \
+    return 2.0 * libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() + Q::precision() + std::fabs(std::tanh(_u) - std::tanh(_a)); \
+}
+    test_the_precision_of<Q1>(tanh_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(tanh_op(), error(Q2), custom_log);
+    test_the_precision_of<Q3>(tanh_op(), error(Q3), custom_log);
+#undef error
+
+    // the large results raise the overflow
+    using Q4 = libq::Q<31, 20, 0, libq::overflow_exception_policy>;
+    BOOST_CHECK_CLOSE(static_cast<double>(std::sinh(Q4(7.0))), std::sinh(7.0), 1e-4);
+    BOOST_CHECK_THROW(std::sinh(Q4(40.0)), std::overflow_error);
+    BOOST_CHECK_THROW(std::cosh(Q4(-40.0)), std::overflow_error);
+}
+template<std::size_t bits>
+class truncated_cos_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::cos<bits>(_x)); }
+    double operator()(double _x, double _y) const{ return std::cos(_x); }
+};
+template<std::size_t bits>
+class truncated_sin_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::sin<bits>(_x)); }
+    double operator()(double _x, double _y) const{ return std::sin(_x); }
+};
+template<std::size_t bits>
+class truncated_tanh_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::tanh<bits>(_x)); }
+    double operator()(double _x, double _y) const{ return std::tanh(_x); }
+};
+template<std::size_t bits>
+class truncated_atan2_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _y, T2 _x) const{ return static_cast<double>(libq::atan2<bits>(_y, _x)); }
+    double operator()(double _y, double _x) const{ return std::atan2(_y, _x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_truncated_cordic)
+{
+#define error(Q, bits) [](double, double, double, double){ \
+    return libq::details::precision_traits<bits, Q::bits_for_fractional>::error_bound() + Q::precision(); \
+}
+    logger custom_log("truncated_cordic.log");
+
+    using Q1 = libq::Q<28, 26>;
+    using Q2 = libq::Q<42, 40>;
+
+    test_the_precision_of<Q1>(truncated_cos_op<10>(), error(Q1, 10), custom_log);
+    test_the_precision_of<Q1>(truncated_cos_op<16>(), error(Q1, 16), custom_log);
+    test_the_precision_of<Q2>(truncated_cos_op<20>(), error(Q2, 20), custom_log);
+
+    // the reduction keeps the accuracy for the large arguments as well
+    using Q3 = libq::Q<31, 26>;
+    using Q4 = libq::Q<44, 40>;
+
+    test_the_precision_of<Q3>(truncated_sin_op<16>(), error(Q3, 16), custom_log);
+    test_the_precision_of<Q4>(truncated_cos_op<20>(), error(Q4, 20), custom_log);
+    test_the_precision_of<Q3>(truncated_tanh_op<16>(), error(Q3, 16), custom_log);
+
+    // the rounding of the vector coordinates rotates it by ulp/|v| at most
+    test_the_precision_of<Q3>(truncated_atan2_op<16>(),
+                              [](double, double, double _y, double _x){
+                                  return libq::details::precision_traits<16, Q3::bits_for_fractional>::error_bound() +
+                                      Q3::precision() * (1.0 + 1.0 / std::hypot(_y, _x));
+                              },
+                              custom_log);
+#undef error
+}
+template<std::size_t bits>
+class hypot_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::hypot<bits>(_x, _y)); }
+    double operator()(double _x, double _y) const{ return std::hypot(_x, _y); }
+};
+template<std::size_t bits>
+class polar_angle_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::polar<bits>(_x, _y).second); }
+    double operator()(double _x, double _y) const{ return std::atan2(_y, _x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_polar)
+{
+    logger custom_log("polar.log");
+
+    using Q1 = libq::Q<31, 20>;
+    using Q2 = libq::Q<31, 28>;
+    using Q3 = libq::Q<40, 36>;
+
+    // the error of the magnitude is absolute for the long vectors as well, the rounding of the coordinates
+    // changes it by ulp at most
+#define error(Q, bits) [](double, double, double, double){ \
+    return libq::details::precision_traits<bits, Q::bits_for_fractional>::error_bound() + 2.0 * Q::precision(); \
+}
+    test_the_precision_of<Q1>(hypot_op<20>(), error(Q1, 20), custom_log);
+    test_the_precision_of<Q2>(hypot_op<28>(), error(Q2, 28), custom_log);
+    test_the_precision_of<Q3>(hypot_op<36>(), error(Q3, 36), custom_log);
+    test_the_precision_of<Q1>(hypot_op<12>(), error(Q1, 12), custom_log);
+#undef error
+
+    BOOST_CHECK_SMALL(static_cast<double>(std::hypot(Q1(1834.0), Q1(0.7))) - std::hypot(1834.0, static_cast<double>(Q1(0.7))), 2.0 * Q1::precision());
+
+    // the rounding of the vector coordinates rotates it by ulp/|v| at most
+    test_the_precision_of<Q2>(polar_angle_op<28>(),
+                              [](double, double, double _x, double _y){
+                                  return libq::details::precision_traits<28, Q2::bits_for_fractional>::error_bound() +
+                                      Q2::precision() * (1.0 + 1.0 / std::hypot(_y, _x));
+                              },
+                              custom_log);
+}
+class cordic_rotation_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{
+        using engine = libq::cordic::engine<libq::cordic::rotation, libq::cordic::circular, T1, 30u>;
+        return static_cast<double>(std::get<1>(engine::apply(T1(1.0 / engine::gain()), T1(0.0), T1(0.75 * static_cast<double>(_x)))));
+    }
+    double operator()(double _x, double _y) const{ return std::sin(0.75 * _x); }
+};
+class cordic_vectoring_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{
+        using engine = libq::cordic::engine<libq::cordic::vectoring, libq::cordic::circular, T1, 30u>;
+        return static_cast<double>(std::get<2>(engine::apply(T1(0.5), T1(0.5 * static_cast<double>(_x)), T1(0.0))));
+    }
+    double operator()(double _x, double _y) const{ return std::atan(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_cordic_engine)
+{
+    logger custom_log("cordic_engine.log");
+
+    // the angle of the rotation is within the convergence interval
+    using Q = libq::Q<31, 30>;
+
+    auto const error = [](double, double, double, double){
+        return libq::details::precision_traits<30, 30>::error_bound() + Q::precision();
+    };
+    test_the_precision_of<Q>(cordic_rotation_op(), error, custom_log);
+    test_the_precision_of<Q>(cordic_vectoring_op(), error, custom_log);
+}
+class rotate_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::rotate(_x, _y, T1(2.5)).first); }
+    double operator()(double _x, double _y) const{ return _x * std::cos(2.5) - _y * std::sin(2.5); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_rotate)
+{
+    logger custom_log("rotate.log");
+
+    using Q1 = libq::Q<31, 24>;
+    using Q2 = libq::Q<50, 40>;
+    using Q3 = libq::Q<31, 20>;
+
+    // the error is absolute for the vectors of any length, the rounding of the coordinates rotates by ulp at most
+#define error(Q) [](double, double, double, double){ \
+    return libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() + 2.0 * Q::precision(); \
+}
+    test_the_precision_of<Q1>(rotate_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(rotate_op(), error(Q2), custom_log);
+    test_the_precision_of<Q3>(rotate_op(), error(Q3), custom_log);
+#undef error
+
+    // the long vectors keep all the bits of the coordinates
+    auto const v = libq::rotate(Q3(1834.0), Q3(0.7), Q3(0.0));
+    BOOST_CHECK_SMALL(static_cast<double>(v.first) - static_cast<double>(Q3(1834.0)), Q3::precision());
+    BOOST_CHECK_SMALL(static_cast<double>(v.second) - static_cast<double>(Q3(0.7)), Q3::precision());
+}
+class binary_angle_sin_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::sin(libq::angle<24>(_x))); }
+    double operator()(double _x, double _y) const{ return std::sin(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_binary_angle)
+{
+    logger custom_log("binary_angle.log");
+
+    // the conversion to the binary angle rounds the radians to 2 pi / 2^24
+    auto const error = [](double, double, double, double){
+        return libq::details::precision_traits<22, 30>::error_bound() + std::ldexp(1.0, -22) + 3.14159265358979 / (1u << 24);
+    };
+    test_the_precision_of<libq::Q<40, 30> >(binary_angle_sin_op(), error, custom_log);
+}
+class double_rotation_asin_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::asin(T1(0.45 * static_cast<double>(_x)))); }
+    double operator()(double _x, double _y) const{ return std::asin(0.45 * _x); }
+};
+class double_rotation_acos_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::acos(T1(0.45 * static_cast<double>(_x)))); }
+    double operator()(double _x, double _y) const{ return std::acos(0.45 * _x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_double_rotation_cordic)
+{
+    logger custom_log("double_rotation_cordic.log");
+
+    // arguments are within [-0.9, 0.9]: the derivative is below 2.3
+    using Q = libq::Q<31, 30>;
+
+    auto const error = [](double, double, double, double){
+        return libq::details::precision_traits<30, 30>::error_bound() + 3.0 * Q::precision();
+    };
+    test_the_precision_of<Q>(double_rotation_asin_op(), error, custom_log);
+    test_the_precision_of<Q>(double_rotation_acos_op(), error, custom_log);
+}
+class radix4_sin_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::sin<libq::engine::cordic_radix4>(_x)); }
+    double operator()(double _x, double _y) const{ return std::sin(_x); }
+};
+class radix4_atan_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::atan<libq::engine::cordic_radix4>(_x)); }
+    double operator()(double _x, double _y) const{ return std::atan(_x); }
+};
+class radix4_asin_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::asin<libq::engine::cordic_radix4>(T1(0.45 * static_cast<double>(_x)))); }
+    double operator()(double _x, double _y) const{ return std::asin(0.45 * _x); }
+};
+class radix4_acos_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::acos<libq::engine::cordic_radix4>(T1(0.45 * static_cast<double>(_x)))); }
+    double operator()(double _x, double _y) const{ return std::acos(0.45 * _x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_radix4_cordic)
+{
+    logger custom_log("radix4_cordic.log");
+
+    // 16-bit formats: the vector of atan grows in 2 integer bits of atan_of, so its argument is below 2 there
+    using Q0 = libq::Q<15, 12>;
+    using Q3 = libq::Q<13, 12>;
+    using Q1 = libq::Q<20, 16>;
+    using Q2 = libq::Q<31, 28>;
+
+    // every step merges two iterations, so the error is the one of CORDIC
+#define error(Q) [](double, double, double, double){ \
+    return libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() + Q::precision(); \
+}
+    test_the_precision_of<Q0>(radix4_sin_op(), error(Q0), custom_log);
+    test_the_precision_of<Q1>(radix4_sin_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(radix4_sin_op(), error(Q2), custom_log);
+    test_the_precision_of<Q3>(radix4_atan_op(), error(Q3), custom_log);
+    test_the_precision_of<Q1>(radix4_atan_op(), error(Q1), custom_log);
+#undef error
+
+    // the double rotations of asin and acos take the arguments within [-0.9, 0.9], the derivative is below 2.3
+    using Q4 = libq::Q<31, 30>;
+    using Q5 = libq::Q<41, 40>;
+#define error(Q) [](double, double, double, double){ \
+    return libq::details::precision_traits<Q::bits_for_fractional, Q::bits_for_fractional>::error_bound() + 3.0 * Q::precision(); \
+}
+    test_the_precision_of<Q3>(radix4_asin_op(), error(Q3), custom_log);
+    test_the_precision_of<Q4>(radix4_asin_op(), error(Q4), custom_log);
+    test_the_precision_of<Q5>(radix4_asin_op(), error(Q5), custom_log);
+    test_the_precision_of<Q3>(radix4_acos_op(), error(Q3), custom_log);
+    test_the_precision_of<Q4>(radix4_acos_op(), error(Q4), custom_log);
+    test_the_precision_of<Q5>(radix4_acos_op(), error(Q5), custom_log);
+#undef error
+}
+class recip_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::recip(_x)); }
+    double operator()(double _x, double _y) const{ return 1.0 / _x; }
+};
+class rsqrt_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::rsqrt(_x)); }
+    double operator()(double _x, double _y) const{ return 1.0 / std::sqrt(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_reciprocals)
+{
+    logger custom_log("reciprocals.log");
+
+    using Q1 = libq::Q<31, 24>;
+    using Q2 = libq::UQ<32, 16>;
+    using R1 = libq::details::recip_of<Q1>::promoted_type;
+    using S2 = libq::details::rsqrt_of<Q2>::promoted_type;
+
+    // the result is rounded, so the error is 0.5 ulp plus the error of
+    // the argument rounding
+    test_the_precision_of<Q1>(recip_op(),
+                              [](double _u, double, double _x, double){
+                                  return R1::precision() + std::fabs(1.0 / _u - 1.0 / _x);
+                              },
+                              custom_log);
+    test_the_precision_of<Q2>(rsqrt_op(),
+                              [](double _u, double, double _x, double){
+                                  return S2::precision() + std::fabs(1.0 / std::sqrt(_u) - 1.0 / std::sqrt(_x));
+                              },
+                              custom_log);
+}
+class sqrt_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::sqrt(_x)); }
+    double operator()(double _x, double _y) const{ return std::sqrt(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_sqrt)
+{
+    logger custom_log("sqrt.log");
+
+    using Q1 = libq::UQ<32, 16>;
+    using Q2 = libq::UQ<32, 30>;
+    using S1 = decltype(std::sqrt(Q1(0)));
+    using S2 = decltype(std::sqrt(Q2(0)));
+
+    // the digit-by-digit engine rounds the result, the largest arguments
+    // are saturated to the largest result
+    test_the_precision_of<Q1>(sqrt_op(),
+                              [](double _u, double, double _x, double){
+                                  return S1::precision() + std::fabs(std::sqrt(_u) - std::sqrt(_x));
+                              },
+                              custom_log);
+    test_the_precision_of<Q2>(sqrt_op(),
+                              [](double _u, double, double _x, double){
+                                  return S2::precision() + std::fabs(std::sqrt(_u) - std::sqrt(_x));
+                              },
+                              custom_log);
+}
+class polynomial_sin_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::sin<libq::engine::polynomial>(_x)); }
+    double operator()(double _x, double _y) const{ return std::sin(_x); }
+};
+class polynomial_atan_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::atan<libq::engine::polynomial>(_x)); }
+    double operator()(double _x, double _y) const{ return std::atan(_x); }
+};
+class polynomial_tanh_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::tanh<libq::engine::polynomial>(_x)); }
+    double operator()(double _x, double _y) const{ return std::tanh(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_polynomial_engine)
+{
+    logger custom_log("polynomial.log");
+
+    using Q1 = libq::Q<31, 28>;
+    using Q2 = libq::Q<50, 44>;
+
+    // the polynomial error is below a quarter of ulp, the result is rounded
+    // and the rounding of the argument changes the result by ulp at most
+#define error(Q) [](double, double, double, double){ return 1.75 * Q::precision(); }
+    test_the_precision_of<Q1>(polynomial_sin_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(polynomial_sin_op(), error(Q2), custom_log);
+    test_the_precision_of<Q1>(polynomial_atan_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(polynomial_atan_op(), error(Q2), custom_log);
+    test_the_precision_of<Q1>(polynomial_tanh_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(polynomial_tanh_op(), error(Q2), custom_log);
+#undef error
+}
+class table_sin_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::sin<libq::engine::table>(_x)); }
+    double operator()(double _x, double _y) const{ return std::sin(_x); }
+};
+class table_tanh_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::tanh<libq::engine::table>(_x)); }
+    double operator()(double _x, double _y) const{ return std::tanh(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_table_engine)
+{
+    logger custom_log("table.log");
+
+    using Q1 = libq::Q<15, 12>;
+    using Q2 = libq::Q<20, 16>;
+
+    // the interpolation error is below a half of ulp, the result is rounded
+    // and the rounding of the argument changes the result by ulp at most
+#define error(Q) [](double, double, double, double){ return 2.0 * Q::precision(); }
+    test_the_precision_of<Q1>(table_sin_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(table_sin_op(), error(Q2), custom_log);
+    test_the_precision_of<Q1>(table_tanh_op(), error(Q1), custom_log);
+    test_the_precision_of<Q2>(table_tanh_op(), error(Q2), custom_log);
+#undef error
+}
+BOOST_AUTO_TEST_CASE(engine_of_override)
+{
+    using Q1 = libq::Q<14, 11>;
+    using Q2 = libq::Q<22, 18>;
+
+    // the partial specialization switches all the functions of the type, the full one switches a single function
+    Q1 const x(0.7);
+    BOOST_CHECK_EQUAL(std::sqrt(x).value(), libq::sqrt<libq::engine::table>(x).value());
+    BOOST_CHECK_EQUAL(std::sin(x).value(), libq::sin<libq::engine::table>(x).value());
+    BOOST_CHECK_EQUAL(libq::sigmoid(x).value(), libq::sigmoid<libq::engine::table>(x).value());
+
+    // the table engine has no asin and acos, they keep the default engine
+    BOOST_CHECK_EQUAL(std::asin(x).value(), libq::asin<libq::engine::cordic>(x).value());
+    BOOST_CHECK_EQUAL(std::acos(x).value(), libq::acos<libq::engine::cordic>(x).value());
+
+    Q2 const y(0.7);
+    BOOST_CHECK_EQUAL(std::sqrt(y).value(), libq::sqrt<libq::engine::cordic>(y).value());
+    BOOST_CHECK_EQUAL(std::sin(y).value(), libq::sin<libq::engine::cordic>(y).value());
+}
+class logistic
+{
+public:
+    double operator()(double _x) const{ return 1.0 / (1.0 + std::exp(-_x)); }
+};
+template<class Interp>
+class tabulated_op
+{
+public:
+    using table_type = libq::tabulated<libq::Q<15, 11>, libq::Q<16, 15>, logistic, 256u, Interp>;
+
+    static table_type const& table(){ static table_type const instance; return instance; }
+
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(table()(_x)); }
+    double operator()(double _x, double _y) const{ return logistic()(_x); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_tabulated)
+{
+    logger custom_log("tabulated.log");
+
+    using Q = libq::Q<15, 11>;
+
+    // the reported error is measured at 8 points per interval, the slope of the logistic function is not greater than 0.25
+#define error(Interp) [](double _x, double, double _a, double){ \
+    return 1.25 * tabulated_op<Interp>::table().error_bound() + 0.25 * std::fabs(_x - _a); \
+}
+    test_the_precision_of<Q>(tabulated_op<libq::interpolation::nearest>(), error(libq::interpolation::nearest), custom_log);
+    test_the_precision_of<Q>(tabulated_op<libq::interpolation::linear>(), error(libq::interpolation::linear), custom_log);
+    test_the_precision_of<Q>(tabulated_op<libq::interpolation::quadratic>(), error(libq::interpolation::quadratic), custom_log);
+#undef error
+
+    BOOST_CHECK(tabulated_op<libq::interpolation::quadratic>::table().error_bound() < tabulated_op<libq::interpolation::linear>::table().error_bound());
+}
+
+class sigmoid_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::sigmoid(_x)); }
+    double operator()(double _x, double _y) const{ return logistic()(_x); }
+};
+class erf_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(std::erf(_x)); }
+    double operator()(double _x, double _y) const{ return std::erf(_x); }
+};
+class gelu_op
+{
+public:
+    template<typename T1, typename T2>
+    double operator()(T1 _x, T2 _y) const{ return static_cast<double>(libq::gelu(_x)); }
+    double operator()(double _x, double _y) const{ return 0.5 * _x * std::erfc(-_x / std::sqrt(2.0)); }
+};
+BOOST_AUTO_TEST_CASE(precision_of_activations)
+{
+    logger custom_log("activations.log");
+
+    using Q1 = libq::Q<15, 12>;
+    using Q2 = libq::Q<20, 16>;
+
+    // the interpolation error is below a quarter of ulp, the result is rounded and the rounding of the argument
+    // changes the result by slope * ulp at most: the slopes of erf and GELU are below 1.13
+#define error(Q, ulps) [](double, double, double, double){ return ulps * Q::precision(); }
+    test_the_precision_of<Q1>(sigmoid_op(), error(Q1, 2.0), custom_log);
+    test_the_precision_of<Q2>(sigmoid_op(), error(Q2, 2.0), custom_log);
+    test_the_precision_of<Q1>(erf_op(), error(Q1, 3.0), custom_log);
+    test_the_precision_of<Q2>(erf_op(), error(Q2, 3.0), custom_log);
+    test_the_precision_of<Q1>(gelu_op(), error(Q1, 3.0), custom_log);
+    test_the_precision_of<Q2>(gelu_op(), error(Q2, 3.0), custom_log);
+#undef error
+
+    // the probabilities of softmax are compared with the ones of the rounded arguments
+    std::vector<Q2> x;
+    for (std::size_t i = 0; i != 100u; ++i) {
+        x.push_back(Q2(uniform_distribution_sample<Q2>()));
+    }
+    std::vector<libq::details::softmax_of<Q2>::promoted_type> y(x.size());
+    libq::softmax(x.begin(), x.end(), y.begin());
+
+    double maximum = static_cast<double>(x.front());
+    for (Q2 const& v : x) {
+        maximum = std::max(maximum, static_cast<double>(v));
+    }
+    double sum = 0.0;
+    for (Q2 const& v : x) {
+        sum += std::exp(static_cast<double>(v) - maximum);
+    }
+    for (std::size_t i = 0; i != x.size(); ++i) {
+        double const expected = std::exp(static_cast<double>(x[i]) - maximum) / sum;
+        BOOST_CHECK_SMALL(static_cast<double>(y[i]) - expected, Q2::precision());
+    }
+}
+
+template<class Output, typename Q>
+double nco_error()
+{
+    using oscillator_type = libq::nco<32, Q, Output>;
+
+    oscillator_type oscillator(oscillator_type::tuning_word(1234.567, 48000.0), oscillator_type::phase_type::from_turns(0.3));
+    double const first = oscillator.phase().turns();
+    double const step = oscillator.step().turns();
+
+    std::vector<Q> sines(1000u), cosines(1000u);
+    oscillator.generate(sines.size() / 2u, sines.begin(), cosines.begin());
+
+    // the block-wise update of the frequency continues from the phase reached
+    double const middle = oscillator.phase().turns();
+    oscillator.tune(oscillator_type::tuning_word(2000.0, 48000.0));
+    double const next_step = oscillator.step().turns();
+    oscillator.generate(sines.size() / 2u, sines.begin() + sines.size() / 2u, cosines.begin() + cosines.size() / 2u);
+
+    double error = 0.0;
+    for (std::size_t k = 0u; k != sines.size(); ++k) {
+        double const turns = (k < sines.size() / 2u) ? first + step * k : middle + next_step * (k - sines.size() / 2u);
+        double const phi = 8.0 * std::atan(1.0) * turns;
+
+        error = std::max(error, std::fabs(static_cast<double>(sines[k]) - std::sin(phi)));
+        error = std::max(error, std::fabs(static_cast<double>(cosines[k]) - std::cos(phi)));
+    }
+
+    return error;
+}
+BOOST_AUTO_TEST_CASE(precision_of_nco)
+{
+    using Q1 = libq::Q<15, 14>;
+    using Q2 = libq::Q<25, 24>;
+
+    BOOST_CHECK_LE((nco_error<libq::nco_output::cordic, Q1>()), 2.0 * Q1::precision());
+    BOOST_CHECK_LE((nco_error<libq::nco_output::cordic, Q2>()), 2.0 * Q2::precision());
+    BOOST_CHECK_LE((nco_error<libq::nco_output::interpolated, Q1>()), 2.0 * Q1::precision());
+    BOOST_CHECK_LE((nco_error<libq::nco_output::interpolated, Q2>()), 2.0 * Q2::precision());
+
+    // the phase is rounded to the nearest of 2^12 entries of the full turn
+    BOOST_CHECK_LE((nco_error<libq::nco_output::quarter_wave<10u>, Q1>()), std::ldexp(std::atan(1.0), -10) + Q1::precision());
+}
+
+BOOST_AUTO_TEST_CASE(precision_of_sincos_generator)
+{
+    using Q = libq::Q<31, 28>;
+    using angle_type = libq::fixed_point<std::int64_t, 63u - Q::bits_for_fractional, Q::bits_for_fractional, 0, libq::ignorance_policy, libq::ignorance_policy>;
+    using generator_type = libq::sincos_generator<Q>;
+    using R = generator_type::result_type;
+
+    Q const first(0.3);
+    Q const step(-0.0123);
+    std::size_t const count = 3u * generator_type::anchor_period + 5u;
+
+    generator_type generator(first, step);
+    std::vector<R> sines(count), cosines(count);
+    generator.generate(count, sines.begin(), cosines.begin());
+
+    // the recurrence between the anchors adds 2 ulps at most to the error of std::sin and std::cos
+    double anchor_error = 0.0, error = 0.0;
+    for (std::size_t k = 0u; k != count; ++k) {
+        angle_type const angle = angle_type::wrap(first.value() + static_cast<std::int64_t>(k) * step.value());
+        double const phi = static_cast<double>(angle);
+
+        anchor_error = std::max(anchor_error, std::fabs(static_cast<double>(std::sin(angle)) - std::sin(phi)));
+        anchor_error = std::max(anchor_error, std::fabs(static_cast<double>(std::cos(angle)) - std::cos(phi)));
+        error = std::max(error, std::fabs(static_cast<double>(sines[k]) - std::sin(phi)));
+        error = std::max(error, std::fabs(static_cast<double>(cosines[k]) - std::cos(phi)));
+    }
+    BOOST_CHECK_LE(error, anchor_error + 2.0 * R::precision());
+    BOOST_CHECK_EQUAL(generator.index(), count);
+}
+
+template<class ISA, typename Q>
+std::size_t batch_mismatches(double const _lowest, double const _highest)
+{
+    using sin_type = typename libq::details::sin_of<Q>::promoted_type;
+    using atan_type = typename libq::details::atan_of<Q>::promoted_type;
+
+    // 1000 numbers are 15 full blocks and the padded tail
+    std::size_t const count = 1000u;
+    std::vector<Q> x(count);
+    for (std::size_t i = 0u; i != count; ++i) {
+        x[i] = Q(_lowest + (_highest - _lowest) * i / (count - 1u));
+    }
+
+    std::vector<sin_type> sines(count), cosines(count);
+    std::vector<atan_type> arctangents(count);
+    libq::batch::sin<ISA>(x.data(), sines.data(), count);
+    libq::batch::cos<ISA>(x.data(), cosines.data(), count);
+    libq::batch::atan<ISA>(x.data(), arctangents.data(), count);
+
+    std::size_t mismatches = 0u;
+    for (std::size_t i = 0u; i != count; ++i) {
+        mismatches += (sines[i].value() != libq::sin<libq::engine::cordic>(x[i]).value());
+        mismatches += (cosines[i].value() != libq::cos<libq::engine::cordic>(x[i]).value());
+        mismatches += (arctangents[i].value() != libq::atan<libq::engine::cordic>(x[i]).value());
+    }
+
+    return mismatches;
+}
+
+BOOST_AUTO_TEST_CASE(precision_of_batch_trigonometry)
+{
+    // 16-bit, 32-bit and 64-bit lanes
+    BOOST_CHECK_EQUAL((batch_mismatches<libq::isa::native, libq::Q<15, 12> >(-8.0, 8.0)), 0u);
+    BOOST_CHECK_EQUAL((batch_mismatches<libq::isa::native, libq::Q<31, 28> >(-7.0, 7.0)), 0u);
+    BOOST_CHECK_EQUAL((batch_mismatches<libq::isa::native, libq::Q<40, 36> >(-8.0, 8.0)), 0u);
+    BOOST_CHECK_EQUAL((batch_mismatches<libq::isa::scalar, libq::Q<31, 28> >(-7.0, 7.0)), 0u);
+}
+
+template<class ISA, typename Q>
+std::size_t batch_exp_log_sqrt_mismatches(double const _lowest, double const _highest)
+{
+    using exp_type = typename libq::details::exp_of<Q>::promoted_type;
+    using log_type = typename libq::details::batch_log_kernel<Q>::result_type;
+    using sqrt_type = typename libq::details::batch_sqrt_kernel<Q>::result_type;
+
+    // 1000 numbers are 15 full blocks and the padded tail
+    std::size_t const count = 1000u;
+    std::vector<Q> x(count), positive(count);
+    for (std::size_t i = 0u; i != count; ++i) {
+        x[i] = Q(_lowest + (_highest - _lowest) * i / (count - 1u));
+        positive[i] = Q::wrap(1 + (std::numeric_limits<Q>::max().value() - 1) / (count - 1u) * i);
+    }
+
+    std::vector<exp_type> exponents(count);
+    std::vector<log_type> logarithms(count);
+    std::vector<sqrt_type> roots(count);
+    libq::batch::exp<ISA>(x.data(), exponents.data(), count);
+    libq::batch::log<ISA>(positive.data(), logarithms.data(), count);
+    libq::batch::sqrt<ISA>(positive.data(), roots.data(), count);
+
+    std::size_t mismatches = 0u;
+    for (std::size_t i = 0u; i != count; ++i) {
+        mismatches += (exponents[i].value() != libq::exp<libq::engine::cordic>(x[i]).value());
+        mismatches += (logarithms[i].value() != libq::log<libq::engine::cordic>(positive[i]).value());
+        mismatches += (roots[i].value() != libq::sqrt<libq::engine::digit_by_digit>(positive[i]).value());
+    }
+
+    return mismatches;
+}
+
+BOOST_AUTO_TEST_CASE(precision_of_batch_exp_log_sqrt)
+{
+    BOOST_CHECK_EQUAL((batch_exp_log_sqrt_mismatches<libq::isa::native, libq::Q<15, 12> >(-5.0, 5.0)), 0u);
+    BOOST_CHECK_EQUAL((batch_exp_log_sqrt_mismatches<libq::isa::native, libq::Q<40, 36> >(-10.0, 10.0)), 0u);
+    BOOST_CHECK_EQUAL((batch_exp_log_sqrt_mismatches<libq::isa::native, libq::UQ<20, 18> >(0.0, 3.0)), 0u);
+    BOOST_CHECK_EQUAL((batch_exp_log_sqrt_mismatches<libq::isa::scalar, libq::Q<31, 28> >(-5.0, 5.0)), 0u);
+
+    // the radicand of 64 bits is compared as the unsigned integer
+    BOOST_CHECK_EQUAL((batch_exp_log_sqrt_mismatches<libq::isa::native, libq::UQ<63, 31> >(0.0, 40.0)), 0u);
+
+    // the exponents beyond the format saturate or underflow to zero like the scalar ones
+    BOOST_CHECK_EQUAL((batch_exp_log_sqrt_mismatches<libq::isa::native, libq::Q<31, 20> >(-100.0, 100.0)), 0u);
+    BOOST_CHECK_EQUAL((batch_exp_log_sqrt_mismatches<libq::isa::scalar, libq::Q<31, 20> >(-100.0, 100.0)), 0u);
+
+    using Q = libq::Q<31, 20, 0, libq::overflow_exception_policy>;
+    std::vector<Q> const x(100u, Q(40.0));
+    std::vector<libq::details::exp_of<Q>::promoted_type> exponents(x.size());
+    BOOST_CHECK_THROW(libq::batch::exp(x.data(), exponents.data(), x.size()), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(precision_of_batch_dispatch)
+{
+    // every level the host supports runs the kernels compiled for it
+    libq::isa::level const supported = libq::isa::supported();
+    for (int i = 0; i <= static_cast<int>(supported); ++i) {
+        libq::isa::level const level = static_cast<libq::isa::level>(i);
+        BOOST_CHECK(libq::isa::force(level) == level);
+        BOOST_CHECK(libq::isa::active() == level);
+
+        BOOST_CHECK_EQUAL((batch_mismatches<libq::isa::dispatched, libq::Q<15, 12> >(-8.0, 8.0)), 0u);
+        BOOST_CHECK_EQUAL((batch_mismatches<libq::isa::dispatched, libq::Q<40, 36> >(-8.0, 8.0)), 0u);
+        BOOST_CHECK_EQUAL((batch_exp_log_sqrt_mismatches<libq::isa::dispatched, libq::Q<31, 28> >(-5.0, 5.0)), 0u);
+    }
+
+    // the level is narrowed to the supported one
+    BOOST_CHECK(libq::isa::force(libq::isa::level::avx512) == supported);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_transform)
+{
+    using Q = libq::Q<31, 28>;
+    using sin_type = libq::details::sin_of<Q>::promoted_type;
+
+    // the chunks of 1000 numbers: the last one is padded
+    std::size_t const count = 100003u;
+    std::vector<Q> x(count);
+    for (std::size_t i = 0u; i != count; ++i) {
+        x[i] = Q(-7.0 + 14.0 * i / (count - 1u));
+    }
+
+    std::vector<sin_type> expected(count), batch(count), scalar(count);
+    libq::batch::sin(x.data(), expected.data(), count);
+    libq::batch::sin(libq::parallel::parallel_policy(0u, 1000u), x.data(), batch.data(), count);
+    libq::parallel::transform(libq::parallel::par, x.begin(), x.end(), scalar.begin(),
+                              [](Q const _x) { return libq::sin<libq::engine::cordic>(_x); });
+
+    std::size_t mismatches = 0u;
+    for (std::size_t i = 0u; i != count; ++i) {
+        mismatches += (batch[i].value() != expected[i].value());
+        mismatches += (scalar[i].value() != expected[i].value());
+    }
+    BOOST_CHECK_EQUAL(mismatches, 0u);
+
+    // the pool of 4 threads runs every chunk once, whatever the host has
+    libq::parallel::thread_pool pool(4u);
+    std::vector<int> runs(997u, 0);
+    auto run = [&runs](std::size_t const _i) { ++runs[_i]; };
+    pool.run(runs.size(), 4u, run);
+    BOOST_CHECK(std::count(runs.begin(), runs.end(), 1) == static_cast<std::ptrdiff_t>(runs.size()));
+
+    auto fail = [](std::size_t const _i) {
+        if (_i == 500u) {
+            throw std::range_error("the chunk has failed");
+        }
+    };
+    BOOST_CHECK_THROW(pool.run(997u, 4u, fail), std::range_error);
+}
+
 //BOOST_AUTO_TEST_CASE(std_functions)
 //{
 //#define ERROR(limit) [](double, double, double, double){ return limit; }